@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "FoamAdapter/FoamAdapter.hpp"
+#include "FoamAdapter/setup/executorTuning.hpp"
+#include "FoamAdapter/mesh/cellConnectivity.hpp"
+
+#define namespaceFoam
+#include "fvCFD.H"
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+using Foam::Info;
+using Foam::endl;
+using Foam::nl;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+/* Performance regression gate
+ *
+ * Times the mesh conversion, the field conversion and the adapter operators on the case
+ * mesh and compares the medians against a baseline JSON file:
+ *
+ *     {
+ *         "benchmarks": {
+ *             "Serial/meshConversion": { "median": 1.2e-3, "tolerance": 0.5 },
+ *             ...
+ *         }
+ *     }
+ *
+ * A benchmark fails if its median exceeds (1 + tolerance) times the baseline median. The
+ * per benchmark tolerance overrides the -tolerance option. The baseline is only written with
+ * -update, without a baseline the gate exits with skippedExitCode.
+ */
+
+namespace
+{
+
+// reported to ctest as a skipped test
+constexpr int skippedExitCode = 77;
+
+struct BaselineEntry
+{
+    double median;
+    double tolerance;
+};
+
+template<typename Kernel>
+double median(const Foam::label nRepetitions, Kernel kernel)
+{
+    kernel();
+    Kokkos::fence();
+
+    std::vector<double> times;
+    for (Foam::label i = 0; i < nRepetitions; i++)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        kernel();
+        Kokkos::fence();
+        auto end = std::chrono::high_resolution_clock::now();
+        times.push_back(std::chrono::duration<double>(end - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+std::map<std::string, BaselineEntry>
+readBaseline(const std::string& fileName, const double defaultTolerance)
+{
+    std::ifstream is(fileName);
+    std::stringstream content;
+    content << is.rdbuf();
+
+    const std::regex entry(
+        R"re("([^"]+)"\s*:\s*\{\s*"median"\s*:\s*([-+0-9.eE]+)\s*(,\s*"tolerance"\s*:\s*([-+0-9.eE]+)\s*)?\})re"
+    );
+    std::map<std::string, BaselineEntry> baseline;
+    const std::string text = content.str();
+    for (auto it = std::sregex_iterator(text.begin(), text.end(), entry);
+         it != std::sregex_iterator();
+         ++it)
+    {
+        const auto& match = *it;
+        baseline[match[1].str()] = {
+            std::stod(match[2].str()),
+            match[4].matched ? std::stod(match[4].str()) : defaultTolerance
+        };
+    }
+    return baseline;
+}
+
+void writeBaseline(
+    const std::string& fileName,
+    const std::map<std::string, double>& medians,
+    const std::map<std::string, BaselineEntry>& previous,
+    const double defaultTolerance
+)
+{
+    std::ofstream os(fileName);
+    os << "{\n    \"benchmarks\": {\n";
+    size_t i = 0;
+    for (const auto& [name, value] : medians)
+    {
+        const auto old = previous.find(name);
+        const double tolerance = old != previous.end() ? old->second.tolerance : defaultTolerance;
+        os << "        \"" << name << "\": { \"median\": " << std::setprecision(6) << value
+           << ", \"tolerance\": " << tolerance << " }" << (++i < medians.size() ? "," : "")
+           << "\n";
+    }
+    os << "    }\n}\n";
+}
+
+// executors with distinct execution spaces, named as in the controlDict
+std::vector<Foam::word> executorNames()
+{
+    std::vector<Foam::word> names {"Serial"};
+    if constexpr (!std::is_same_v<Kokkos::DefaultHostExecutionSpace, Kokkos::Serial>)
+    {
+        names.push_back("CPU");
+    }
+    if constexpr (!std::is_same_v<Kokkos::DefaultExecutionSpace, Kokkos::DefaultHostExecutionSpace>)
+    {
+        names.push_back("GPU");
+    }
+    return names;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    Foam::argList::addOption("baseline", "file", "baseline JSON, default perfBaseline.json");
+    Foam::argList::addOption("tolerance", "value", "accepted relative slow down, default 0.5");
+    Foam::argList::addOption("repetitions", "n", "timed runs per benchmark, default 20");
+    Foam::argList::addBoolOption("update", "overwrite the baseline with the current medians");
+
+    Kokkos::initialize(argc, argv);
+    int failed = 0;
+    bool skipped = false;
+    {
+#include "setRootCase.H"
+#include "createTime.H"
+
+        const std::string baselineFile =
+            args.getOrDefault<Foam::fileName>("baseline", "perfBaseline.json");
+        const double defaultTolerance = args.getOrDefault<Foam::scalar>("tolerance", 0.5);
+        const Foam::label nRepetitions = args.getOrDefault<Foam::label>("repetitions", 20);
+
+        std::unique_ptr<Foam::fvMesh> meshPtr = Foam::createMesh(runTime);
+        Foam::fvMesh& mesh = *meshPtr;
+
+        Foam::volScalarField T(
+            Foam::IOobject("T", runTime.timeName(), mesh, Foam::IOobject::MUST_READ), mesh
+        );
+        Foam::volVectorField U(
+            Foam::IOobject("U", runTime.timeName(), mesh, Foam::IOobject::MUST_READ), mesh
+        );
+
+        std::map<std::string, double> medians;
+        for (const auto& execName : executorNames())
+        {
+            NeoFOAM::Executor exec = Foam::createExecutor(execName);
+            const std::string prefix = execName + "/";
+
+            medians[prefix + "meshConversion"] =
+                median(nRepetitions, [&]() { Foam::readOpenFOAMMesh(exec, mesh); });
+
+            NeoFOAM::UnstructuredMesh nfMesh = Foam::readOpenFOAMMesh(exec, mesh);
+            medians[prefix + "scalarFieldConversion"] =
+                median(nRepetitions, [&]() { Foam::fromFoamField(exec, T.primitiveField()); });
+            medians[prefix + "vectorFieldConversion"] =
+                median(nRepetitions, [&]() { Foam::fromFoamField(exec, U.primitiveField()); });
+            medians[prefix + "volFieldConversion"] =
+                median(nRepetitions, [&]() { Foam::constructFrom(exec, nfMesh, T); });
+
+            const auto calibration = Foam::calibrateExecutor(exec, mesh, nRepetitions);
+            medians[prefix + "interpolation"] = calibration.interpolation;
+            medians[prefix + "div"] = calibration.div;
+            medians[prefix + "grad"] = calibration.grad;
+            medians[prefix + "bcUpdate"] = calibration.bcUpdate;
+
+            // face based scatter with atomics against the cell based gather of the divergence
+            auto nfT = Foam::constructFrom(exec, nfMesh, T);
+            auto nfDivT = Foam::constructFrom(exec, nfMesh, T);
+            auto nfPhi = Foam::constructSurfaceField(exec, nfMesh, mesh.magSf());
+            auto nfTf = Foam::constructSurfaceField(exec, nfMesh, mesh.magSf());
+            NeoFOAM::Input scheme = NeoFOAM::TokenList({std::string("linear")});
+            fvcc::SurfaceInterpolation interp(
+                exec, nfMesh, fvcc::SurfaceInterpolationFactory::create(exec, nfMesh, scheme)
+            );
+            fvcc::GaussGreenDiv div(exec, nfMesh, NeoFOAM::TokenList({std::string("linear")}));
+            const Foam::CellConnectivity connectivity = Foam::computeCellConnectivity(nfMesh);
+            medians[prefix + "scatterDiv"] = median(
+                nRepetitions,
+                [&]()
+                {
+                    NeoFOAM::fill(nfDivT.internalField(), 0.0);
+                    div.div(nfDivT, nfPhi, nfT);
+                }
+            );
+            medians[prefix + "gatherDiv"] = median(
+                nRepetitions,
+                [&]()
+                {
+                    interp.interpolate(nfT, nfTf);
+                    Foam::gatherDiv(connectivity, nfMesh, nfPhi, nfTf, nfDivT);
+                }
+            );
+        }
+
+        const bool haveBaseline = Foam::isFile(baselineFile);
+        const auto baseline = readBaseline(baselineFile, defaultTolerance);
+
+        std::ostringstream table;
+        table << std::left << std::setw(36) << "benchmark" << std::right << std::setw(14)
+              << "baseline [s]" << std::setw(14) << "median [s]" << std::setw(10) << "ratio"
+              << std::setw(10) << "limit" << "  status\n";
+        for (const auto& [name, value] : medians)
+        {
+            table << std::left << std::setw(36) << name << std::right << std::scientific
+                  << std::setprecision(3);
+            const auto entry = baseline.find(name);
+            if (entry == baseline.end())
+            {
+                table << std::setw(14) << "-" << std::setw(14) << value << std::setw(10) << "-"
+                      << std::setw(10) << "-" << "  new\n";
+                table << std::defaultfloat;
+                continue;
+            }
+            const double ratio = value / entry->second.median;
+            const double limit = 1.0 + entry->second.tolerance;
+            const bool ok = ratio <= limit;
+            failed += !ok;
+            table << std::setw(14) << entry->second.median << std::setw(14) << value
+                  << std::fixed << std::setprecision(2) << std::setw(10) << ratio
+                  << std::setw(10) << limit << (ok ? "  ok\n" : "  FAILED\n");
+            table << std::defaultfloat;
+        }
+        Info << nl << table.str().c_str() << endl;
+
+        if (args.found("update"))
+        {
+            if (Foam::Pstream::master())
+            {
+                writeBaseline(baselineFile, medians, baseline, defaultTolerance);
+            }
+            Info << "Recorded baseline " << baselineFile.c_str() << endl;
+            failed = 0;
+        }
+        else if (!haveBaseline)
+        {
+            Info << "No baseline " << baselineFile.c_str()
+                 << ", skipping the comparison. Record one with -update" << endl;
+            skipped = true;
+        }
+        else if (failed)
+        {
+            Info << failed << " benchmarks slower than the baseline " << baselineFile.c_str()
+                 << endl;
+        }
+    }
+    Kokkos::finalize();
+
+    if (skipped)
+    {
+        return skippedExitCode;
+    }
+    return failed ? 1 : 0;
+}
+
+// ************************************************************************* //
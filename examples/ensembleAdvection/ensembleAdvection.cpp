@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/FoamAdapter.hpp"
+#include "FoamAdapter/ensemble/ensembleField.hpp"
+
+#define namespaceFoam
+#include "fvCFD.H"
+
+using Foam::Info;
+using Foam::endl;
+using Foam::nl;
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+/* Advects an ensemble of scalar fields with different initial conditions and velocity scales
+ * in the periodic vortex of scalarAdvection. All members share one Time, one MeshAdapter and
+ * one executor, and are advanced by a single batched kernel. Member i is written to the
+ * directory member<i> of the case.
+ */
+int main(int argc, char* argv[])
+{
+    Kokkos::initialize(argc, argv);
+    {
+#include "addCheckCaseOptions.H"
+#include "setRootCase.H"
+#include "createTime.H"
+
+        NeoFOAM::Executor exec = Foam::createExecutor(runTime);
+
+        std::unique_ptr<Foam::MeshAdapter> meshPtr = Foam::createMesh(exec, runTime);
+        Foam::MeshAdapter& mesh = *meshPtr;
+        NeoFOAM::UnstructuredMesh& nfMesh = mesh.nfMesh();
+
+        auto [adjustTimeStep, maxCo, maxDeltaT] = Foam::timeControls(runTime);
+
+#include "createFields.H"
+
+        auto nfPhi0 = Foam::constructSurfaceField(exec, nfMesh, phi0);
+        auto nfPhi = Foam::constructSurfaceField(exec, nfMesh, phi);
+        NeoFOAM::Field<NeoFOAM::scalar> memberT(exec, nfMesh.nCells());
+
+        Foam::scalar endTime = runTime.endTime().value();
+
+        while (runTime.run())
+        {
+            Foam::scalar t = runTime.time().value();
+            Foam::scalar dt = runTime.deltaT().value();
+            Foam::scalar periodicScale = Foam::cos(pi * (t + 0.5 * dt) / endTime);
+
+            phi = phi0 * periodicScale;
+            nfPhi.internalField() = nfPhi0.internalField() * periodicScale;
+
+            std::tie(adjustTimeStep, maxCo, maxDeltaT) = Foam::timeControls(runTime);
+            Foam::scalar coNum = maxVelocityScale * Foam::calculateCoNum(phi);
+            if (adjustTimeStep)
+            {
+                Foam::setDeltaT(runTime, maxCo, coNum, maxDeltaT);
+                dt = runTime.deltaT().value();
+            }
+            runTime++;
+
+            Info << "Time = " << runTime.timeName() << endl;
+
+            ensembleT.advanceUpwind(nfPhi.internalField(), nfVelocityScale, dt);
+
+            if (runTime.outputTime())
+            {
+                Info << "writing ensemble members" << endl;
+                for (Foam::label memberi = 0; memberi < nMembers; memberi++)
+                {
+                    ensembleT.getMember(memberi, memberT);
+
+                    Foam::volScalarField T(
+                        Foam::IOobject(
+                            "T",
+                            Foam::fileName("member" + Foam::name(memberi)) / runTime.timeName(),
+                            mesh,
+                            Foam::IOobject::NO_READ,
+                            Foam::IOobject::NO_WRITE,
+                            false
+                        ),
+                        mesh,
+                        Foam::dimensionedScalar(Foam::dimless, 0.0),
+                        "zeroGradient"
+                    );
+                    Foam::detail::copy_impl(T.primitiveFieldRef(), memberT);
+                    T.correctBoundaryConditions();
+                    T.write();
+                }
+            }
+
+            runTime.printExecutionTime(Info);
+        }
+
+        Info << "End\n" << endl;
+    }
+    Kokkos::finalize();
+
+    return 0;
+}
+
+// ************************************************************************* //
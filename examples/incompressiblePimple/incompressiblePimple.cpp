@@ -0,0 +1,564 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/FoamAdapter.hpp"
+#include "FoamAdapter/conversion/convert.hpp"
+#include "FoamAdapter/matrix/lduSystem.hpp"
+#include "FoamAdapter/matrix/lduSolver.hpp"
+#include "FoamAdapter/mesh/nonOrthGeometry.hpp"
+#include "FoamAdapter/operators/convection.hpp"
+#include "FoamAdapter/operators/gradScheme.hpp"
+#include "FoamAdapter/operators/laplacian.hpp"
+#include "FoamAdapter/parallel/reduce.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+
+#define namespaceFoam
+#include "fvCFD.H"
+#include "pimpleControl.H"
+
+using Foam::Info;
+using Foam::endl;
+using Foam::nl;
+using Foam::pimpleControl;
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+using ScalarVolumeField = fvcc::VolumeField<NeoFOAM::scalar>;
+using ScalarSurfaceField = fvcc::SurfaceField<NeoFOAM::scalar>;
+
+namespace
+{
+
+// one component of U with the patch types of U, from which the NeoFOAM conditions are read
+Foam::tmp<Foam::volScalarField>
+componentField(const Foam::volVectorField& U, const Foam::direction cmpt)
+{
+    auto tUi = Foam::tmp<Foam::volScalarField>::New(
+        Foam::IOobject(
+            U.name() + Foam::word(Foam::vector::componentNames[cmpt]),
+            U.time().timeName(),
+            U.mesh(),
+            Foam::IOobject::NO_READ,
+            Foam::IOobject::NO_WRITE,
+            false
+        ),
+        U.mesh(),
+        Foam::dimensionedScalar(U.dimensions(), 0),
+        U.boundaryField().types()
+    );
+    Foam::volScalarField& Ui = tUi.ref();
+    Ui.primitiveFieldRef() = U.primitiveField().component(cmpt);
+    forAll(Ui.boundaryField(), patchi)
+    {
+        Ui.boundaryFieldRef()[patchi] == U.boundaryField()[patchi].component(cmpt);
+    }
+    return tUi;
+}
+
+// fvm::ddt of the Euler scheme, V/dt on the diagonal and V/dt times the old value in the source
+void addEulerDdt(
+    Foam::LduSystem& system,
+    const NeoFOAM::UnstructuredMesh& nfMesh,
+    const NeoFOAM::scalar deltaT,
+    const NeoFOAM::Field<NeoFOAM::scalar>& oldValues
+)
+{
+    const auto volume = nfMesh.cellVolumes().span();
+    const auto old = oldValues.span();
+    auto diag = system.diag.span();
+    auto source = system.source.span();
+
+    NeoFOAM::parallelFor(
+        oldValues.exec(),
+        {0, diag.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            const NeoFOAM::scalar rDeltaTV = volume[celli] / deltaT;
+            diag[celli] += rDeltaTV;
+            source[celli] += rDeltaTV * old[celli];
+        }
+    );
+}
+
+// source -= scale V grad(p) of the component, scale -1 removes it again after the predictor
+void addPressureGradient(
+    Foam::LduSystem& system,
+    const NeoFOAM::UnstructuredMesh& nfMesh,
+    const fvcc::VolumeField<NeoFOAM::Vector>& gradP,
+    const size_t cmpt,
+    const NeoFOAM::scalar scale
+)
+{
+    const auto volume = nfMesh.cellVolumes().span();
+    const auto gradient = gradP.internalField().span();
+    auto source = system.source.span();
+
+    NeoFOAM::parallelFor(
+        gradP.exec(),
+        {0, source.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            source[celli] -= scale * volume[celli] * gradient[celli](cmpt);
+        }
+    );
+}
+
+// Dav is the diagonal averaged over the components as fvMatrix::A and rAU = V / Dav
+void averageDiag(
+    const std::vector<Foam::LduSystem>& systems,
+    const NeoFOAM::UnstructuredMesh& nfMesh,
+    NeoFOAM::Field<NeoFOAM::scalar>& Dav,
+    NeoFOAM::Field<NeoFOAM::scalar>& rAU
+)
+{
+    const NeoFOAM::scalar rNCmpts = 1.0 / systems.size();
+    auto average = Dav.span();
+    NeoFOAM::fill(Dav, 0.0);
+    for (const Foam::LduSystem& system : systems)
+    {
+        const auto diag = system.diag.span();
+        NeoFOAM::parallelFor(
+            Dav.exec(),
+            {0, average.size()},
+            KOKKOS_LAMBDA(const size_t celli) { average[celli] += rNCmpts * diag[celli]; }
+        );
+    }
+
+    const auto volume = nfMesh.cellVolumes().span();
+    auto result = rAU.span();
+    NeoFOAM::parallelFor(
+        rAU.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t celli) { result[celli] = volume[celli] / average[celli]; }
+    );
+}
+
+// HbyA = H / A with the averaged diagonal, i.e. (source - A U) / Dav + U
+void hByA(
+    const Foam::CellConnectivity& connectivity,
+    const Foam::LduSystem& system,
+    const NeoFOAM::Field<NeoFOAM::scalar>& Dav,
+    const ScalarVolumeField& U,
+    NeoFOAM::Field<NeoFOAM::scalar>& HbyA
+)
+{
+    Foam::Amul(connectivity, system, U.internalField(), HbyA);
+
+    const auto source = system.source.span();
+    const auto average = Dav.span();
+    const auto u = U.internalField().span();
+    auto result = HbyA.span();
+    NeoFOAM::parallelFor(
+        U.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            result[celli] = (source[celli] - result[celli]) / average[celli] + u[celli];
+        }
+    );
+}
+
+// phiHbyA += linear(HbyA) times the component of Sf. As in constrainHbyA, the boundary faces of
+// fixed value patches take the value of U, the faces of assignable patches, e.g. zeroGradient
+// with a value fraction of 0, take HbyA of the face cell
+void addComponentFlux(
+    const NeoFOAM::UnstructuredMesh& nfMesh,
+    const NeoFOAM::Field<NeoFOAM::scalar>& weights,
+    const NeoFOAM::Field<NeoFOAM::scalar>& HbyA,
+    const ScalarVolumeField& U,
+    const size_t cmpt,
+    ScalarSurfaceField& phiHbyA
+)
+{
+    const size_t nInternalFaces = nfMesh.nInternalFaces();
+    const auto owner = nfMesh.faceOwner().span();
+    const auto neighbour = nfMesh.faceNeighbour().span();
+    const auto Sf = nfMesh.faceAreas().span();
+    const auto boundaryNf = nfMesh.boundaryMesh().nf().span();
+    const auto boundaryMagSf = nfMesh.boundaryMesh().magSf().span();
+    const auto faceCells = nfMesh.boundaryMesh().faceCells().span();
+    const auto w = weights.span();
+    const auto h = HbyA.span();
+    const auto boundaryValues = U.boundaryField().value().span();
+    const auto valueFraction = U.boundaryField().valueFraction().span();
+    auto result = phiHbyA.internalField().span();
+
+    NeoFOAM::parallelFor(
+        U.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t facei) {
+            if (facei < nInternalFaces)
+            {
+                const NeoFOAM::scalar hf =
+                    w[facei] * h[owner[facei]] + (1.0 - w[facei]) * h[neighbour[facei]];
+                result[facei] += hf * Sf[facei](cmpt);
+            }
+            else
+            {
+                const size_t bfacei = facei - nInternalFaces;
+                const NeoFOAM::scalar hf = valueFraction[bfacei] == 0.0
+                                             ? h[faceCells[bfacei]]
+                                             : boundaryValues[bfacei];
+                result[facei] += hf * boundaryNf[bfacei](cmpt) * boundaryMagSf[bfacei];
+            }
+        }
+    );
+}
+
+// rAUf = linear(rAU), the boundary faces take the value of the face cell
+void interpolateRAU(
+    const NeoFOAM::UnstructuredMesh& nfMesh,
+    const NeoFOAM::Field<NeoFOAM::scalar>& weights,
+    const NeoFOAM::Field<NeoFOAM::scalar>& rAU,
+    ScalarSurfaceField& rAUf
+)
+{
+    const size_t nInternalFaces = nfMesh.nInternalFaces();
+    const auto owner = nfMesh.faceOwner().span();
+    const auto neighbour = nfMesh.faceNeighbour().span();
+    const auto faceCells = nfMesh.boundaryMesh().faceCells().span();
+    const auto w = weights.span();
+    const auto r = rAU.span();
+    auto result = rAUf.internalField().span();
+
+    NeoFOAM::parallelFor(
+        rAU.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t facei) {
+            result[facei] = facei < nInternalFaces
+                              ? w[facei] * r[owner[facei]] + (1.0 - w[facei]) * r[neighbour[facei]]
+                              : r[faceCells[facei - nInternalFaces]];
+        }
+    );
+}
+
+// source += V div(phiHbyA), i.e. the right hand side of laplacian(rAUf, p) == div(phiHbyA)
+void addFluxDivergence(
+    const Foam::CellConnectivity& connectivity,
+    const ScalarSurfaceField& phiHbyA,
+    Foam::LduSystem& system
+)
+{
+    const auto offsets = connectivity.offsets.span();
+    const auto faces = connectivity.faces.span();
+    const auto signs = connectivity.signs.span();
+    const auto flux = phiHbyA.internalField().span();
+    auto source = system.source.span();
+
+    NeoFOAM::parallelFor(
+        phiHbyA.exec(),
+        {0, source.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            NeoFOAM::scalar sum = 0.0;
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                sum += signs[j] * flux[faces[j]];
+            }
+            source[celli] += sum;
+        }
+    );
+}
+
+// phi = phiHbyA - rAUf |Sf| snGrad(p), i.e. phiHbyA - pEqn.flux()
+void correctFlux(
+    const NeoFOAM::UnstructuredMesh& nfMesh,
+    const ScalarSurfaceField& phiHbyA,
+    const ScalarSurfaceField& rAUf,
+    const ScalarSurfaceField& snGradP,
+    ScalarSurfaceField& phi
+)
+{
+    const size_t nInternalFaces = nfMesh.nInternalFaces();
+    const auto magSf = nfMesh.magFaceAreas().span();
+    const auto boundaryMagSf = nfMesh.boundaryMesh().magSf().span();
+    const auto fluxHbyA = phiHbyA.internalField().span();
+    const auto rAUfValues = rAUf.internalField().span();
+    const auto snGrad = snGradP.internalField().span();
+    auto result = phi.internalField().span();
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t facei) {
+            const NeoFOAM::scalar area =
+                facei < nInternalFaces ? magSf[facei] : boundaryMagSf[facei - nInternalFaces];
+            result[facei] = fluxHbyA[facei] - rAUfValues[facei] * area * snGrad[facei];
+        }
+    );
+}
+
+// U = HbyA - rAU grad(p) of the component
+void correctVelocity(
+    const NeoFOAM::Field<NeoFOAM::scalar>& HbyA,
+    const NeoFOAM::Field<NeoFOAM::scalar>& rAU,
+    const fvcc::VolumeField<NeoFOAM::Vector>& gradP,
+    const size_t cmpt,
+    ScalarVolumeField& U
+)
+{
+    const auto h = HbyA.span();
+    const auto r = rAU.span();
+    const auto gradient = gradP.internalField().span();
+    auto result = U.internalField().span();
+
+    NeoFOAM::parallelFor(
+        U.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            result[celli] = h[celli] - r[celli] * gradient[celli](cmpt);
+        }
+    );
+    U.correctBoundaryConditions();
+}
+
+// the continuity errors of the corrected flux as printed by continuityErrs.H
+void continuityErrors(
+    const Foam::CellConnectivity& connectivity,
+    const NeoFOAM::UnstructuredMesh& nfMesh,
+    const ScalarSurfaceField& phi,
+    const Foam::scalar deltaT,
+    Foam::scalar& cumulativeContErr
+)
+{
+    const auto offsets = connectivity.offsets.span();
+    const auto faces = connectivity.faces.span();
+    const auto signs = connectivity.signs.span();
+    const auto flux = phi.internalField().span();
+    const auto volume = nfMesh.cellVolumes().span();
+
+    NeoFOAM::scalar sumLocal = 0;
+    NeoFOAM::scalar global = 0;
+    NeoFOAM::scalar totalVolume = 0;
+    Foam::detail::parallelReduce(
+        phi.exec(),
+        "continuityErrors",
+        {0, volume.size()},
+        KOKKOS_LAMBDA(
+            const size_t celli,
+            NeoFOAM::scalar& lsumLocal,
+            NeoFOAM::scalar& lglobal,
+            NeoFOAM::scalar& lvolume
+        ) {
+            NeoFOAM::scalar sum = 0.0;
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                sum += signs[j] * flux[faces[j]];
+            }
+            lsumLocal += Kokkos::abs(sum);
+            lglobal += sum;
+            lvolume += volume[celli];
+        },
+        Kokkos::Sum<NeoFOAM::scalar>(sumLocal),
+        Kokkos::Sum<NeoFOAM::scalar>(global),
+        Kokkos::Sum<NeoFOAM::scalar>(totalVolume)
+    );
+
+    const Foam::scalar V =
+        Foam::returnReduce(Foam::scalar(totalVolume), Foam::sumOp<Foam::scalar>());
+    const Foam::scalar sumLocalContErr =
+        deltaT * Foam::returnReduce(Foam::scalar(sumLocal), Foam::sumOp<Foam::scalar>()) / V;
+    const Foam::scalar globalContErr =
+        deltaT * Foam::returnReduce(Foam::scalar(global), Foam::sumOp<Foam::scalar>()) / V;
+    cumulativeContErr += globalContErr;
+
+    Info << "time step continuity errors : sum local = " << sumLocalContErr
+         << ", global = " << globalContErr << ", cumulative = " << cumulativeContErr << endl;
+}
+
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+int main(int argc, char* argv[])
+{
+    Kokkos::initialize(argc, argv);
+    {
+#include "addCheckCaseOptions.H"
+#include "setRootCase.H"
+#include "createTime.H"
+
+        // the solver sums and the LduSystem do not couple processor interfaces
+        if (Foam::Pstream::parRun())
+        {
+            FatalErrorInFunction << "incompressiblePimple does not support parallel runs"
+                                 << exit(FatalError);
+        }
+
+        NeoFOAM::Executor exec = createExecutor(runTime);
+
+        std::unique_ptr<Foam::MeshAdapter> meshPtr = Foam::createMesh(exec, runTime);
+        Foam::MeshAdapter& mesh = *meshPtr;
+
+#define PIMPLE_CONTROL
+#include "createControl.H"
+
+        auto [adjustTimeStep, maxCo, maxDeltaT] = Foam::timeControls(runTime);
+
+#include "createFields.H"
+
+        Info << "creating NeoFOAM fields" << endl;
+        NeoFOAM::UnstructuredMesh& nfMesh = mesh.nfMesh();
+        const Foam::CellConnectivity& connectivity = mesh.cellConnectivity();
+        const size_t nCells = nfMesh.nCells();
+
+        // the velocity is solved component by component, the components of the empty
+        // directions are not solved and stay zero
+        std::vector<Foam::direction> cmpts;
+        std::vector<ScalarVolumeField> nfU;
+        std::vector<NeoFOAM::Field<NeoFOAM::scalar>> nfUOld;
+        std::vector<NeoFOAM::Field<NeoFOAM::scalar>> HbyA;
+        for (Foam::direction cmpt = 0; cmpt < Foam::vector::nComponents; cmpt++)
+        {
+            if (mesh.solutionD()[cmpt] == 1)
+            {
+                cmpts.push_back(cmpt);
+                nfU.push_back(Foam::constructFrom(exec, nfMesh, componentField(U, cmpt)()));
+                nfUOld.emplace_back(exec, nCells);
+                HbyA.emplace_back(exec, nCells);
+            }
+        }
+        auto nfP = Foam::constructFrom(exec, nfMesh, p);
+        auto nfPhi = Foam::constructSurfaceField(exec, nfMesh, phi);
+        auto nfNu = Foam::constructSurfaceField(exec, nfMesh, nuf);
+        ScalarSurfaceField phiHbyA(nfPhi);
+        ScalarSurfaceField rAUf(nfPhi);
+        ScalarSurfaceField snGradP(nfPhi);
+        NeoFOAM::Field<NeoFOAM::scalar> Dav(exec, nCells);
+        NeoFOAM::Field<NeoFOAM::scalar> rAU(exec, nCells);
+        fvcc::VolumeField<NeoFOAM::Vector> gradP = Foam::gradientField(exec, nfMesh);
+        const NeoFOAM::Field<NeoFOAM::scalar> weights = Foam::computeLinearWeights(nfMesh);
+
+        Foam::Convection convectionU(mesh, Foam::convert(mesh.divScheme("div(phi,U)")));
+        Foam::Laplacian laplacianU(mesh, Foam::convert(mesh.laplacianScheme("laplacian(nu,U)")));
+        Foam::Laplacian laplacianP(
+            mesh, Foam::convert(mesh.laplacianScheme("laplacian((1|A(U)),p)"))
+        );
+        Foam::SnGrad snGradPScheme(mesh, Foam::convert(mesh.snGradScheme("snGrad(p)")));
+        std::unique_ptr<Foam::GradScheme> gradPScheme =
+            Foam::GradScheme::New(mesh, Foam::word("grad(p)"));
+
+        Foam::scalar cumulativeContErr = 0;
+
+        Info << "\nStarting time loop\n" << endl;
+
+        while (runTime.run())
+        {
+            std::tie(adjustTimeStep, maxCo, maxDeltaT) = Foam::timeControls(runTime);
+            Foam::scalar coNum = Foam::calculateCoNum(mesh, nfPhi, runTime.deltaTValue());
+            if (adjustTimeStep)
+            {
+                Foam::setDeltaT(runTime, maxCo, coNum, maxDeltaT);
+            }
+            runTime++;
+
+            Info << "Time = " << runTime.timeName() << nl << endl;
+
+            const NeoFOAM::scalar deltaT = runTime.deltaTValue();
+            for (size_t i = 0; i < cmpts.size(); i++)
+            {
+                nfUOld[i] = nfU[i].internalField();
+            }
+
+            while (pimple.loop())
+            {
+                // the momentum equation of each component without the pressure gradient
+                const Foam::word UName = U.select(pimple.finalInnerIter());
+                gradPScheme->grad(nfP, gradP);
+                std::vector<Foam::LduSystem> UEqns;
+                for (size_t i = 0; i < cmpts.size(); i++)
+                {
+                    Foam::LduSystem& UEqn = UEqns.emplace_back(nfMesh);
+                    addEulerDdt(UEqn, nfMesh, deltaT, nfUOld[i]);
+                    convectionU.assemble(nfPhi, nfU[i], UEqn);
+                    laplacianU.assemble(nfNu, nfU[i], UEqn, -1.0);
+                    if (mesh.relaxEquation(UName))
+                    {
+                        Foam::relax(
+                            UEqn, nfU[i].internalField(), mesh.equationRelaxationFactor(UName)
+                        );
+                    }
+
+                    if (pimple.momentumPredictor())
+                    {
+                        addPressureGradient(UEqn, nfMesh, gradP, cmpts[i], 1.0);
+                        Info << Foam::LduSolver(connectivity, mesh.solverDict(UName))
+                                    .solve(UEqn, nfU[i].internalField(), Foam::word(nfU[i].name))
+                             << endl;
+                        addPressureGradient(UEqn, nfMesh, gradP, cmpts[i], -1.0);
+                        nfU[i].correctBoundaryConditions();
+                    }
+                }
+                averageDiag(UEqns, nfMesh, Dav, rAU);
+                interpolateRAU(nfMesh, weights, rAU, rAUf);
+
+                // pressure corrector
+                while (pimple.correct())
+                {
+                    NeoFOAM::fill(phiHbyA.internalField(), 0.0);
+                    for (size_t i = 0; i < cmpts.size(); i++)
+                    {
+                        hByA(connectivity, UEqns[i], Dav, nfU[i], HbyA[i]);
+                        addComponentFlux(nfMesh, weights, HbyA[i], nfU[i], cmpts[i], phiHbyA);
+                    }
+
+                    while (pimple.correctNonOrthogonal())
+                    {
+                        Foam::LduSystem pEqn(nfMesh);
+                        laplacianP.assemble(rAUf, nfP, pEqn);
+                        addFluxDivergence(connectivity, phiHbyA, pEqn);
+                        if (p.needReference())
+                        {
+                            Foam::setReference(pEqn, pRefCell, pRefValue);
+                        }
+
+                        Info << Foam::LduSolver(
+                                    connectivity,
+                                    mesh.solverDict(p.select(pimple.finalInnerIter()))
+                                )
+                                    .solve(pEqn, nfP.internalField(), p.name())
+                             << endl;
+                        nfP.correctBoundaryConditions();
+
+                        if (pimple.finalNonOrthogonalIter())
+                        {
+                            snGradPScheme.snGrad(nfP, snGradP);
+                            correctFlux(nfMesh, phiHbyA, rAUf, snGradP, nfPhi);
+                        }
+                    }
+
+                    continuityErrors(
+                        connectivity, nfMesh, nfPhi, runTime.deltaTValue(), cumulativeContErr
+                    );
+
+                    gradPScheme->grad(nfP, gradP);
+                    for (size_t i = 0; i < cmpts.size(); i++)
+                    {
+                        correctVelocity(HbyA[i], rAU, gradP, cmpts[i], nfU[i]);
+                    }
+                }
+            }
+
+            if (runTime.outputTime())
+            {
+                Foam::detail::copy_impl(p.primitiveFieldRef(), nfP.internalField());
+                p.correctBoundaryConditions();
+                for (size_t i = 0; i < cmpts.size(); i++)
+                {
+                    Foam::scalarField Ui(nCells);
+                    Foam::detail::copy_impl(Ui, nfU[i].internalField());
+                    U.primitiveFieldRef().replace(cmpts[i], Ui);
+                }
+                U.correctBoundaryConditions();
+            }
+            runTime.write();
+
+            runTime.printExecutionTime(Info);
+        }
+
+        Info << "End\n" << endl;
+    }
+    Kokkos::finalize();
+
+    return 0;
+}
+
+// ************************************************************************* //
@@ -1,11 +1,23 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // SPDX-FileCopyrightText: 2023 NeoFOAM authors
 
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "FoamAdapter/FoamAdapter.hpp"
 #include "NeoFOAM/dsl/expression.hpp"
 #include "NeoFOAM/dsl/solver.hpp"
 #include "NeoFOAM/dsl/ddt.hpp"
 #include "FoamAdapter/readers/foamDictionary.hpp"
+#include "FoamAdapter/validation/shadowValidator.hpp"
+#include "FoamAdapter/parallel/stepPipeline.hpp"
+#include "FoamAdapter/profiling/kernelProfiler.hpp"
+#include "FoamAdapter/monitoring/fieldStats.hpp"
+#include "FoamAdapter/monitoring/sampling.hpp"
+#include "FoamAdapter/insitu/extracts.hpp"
+#include "FoamAdapter/writers/timeSeries.hpp"
 
 #include "NeoFOAM/dsl/implicit.hpp"
 #include "NeoFOAM/dsl/explicit.hpp"
@@ -24,6 +36,36 @@ namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
+namespace
+{
+
+// nfT output of a time step, staged on the main thread as plain host data
+struct StagedField
+{
+    std::string path;
+    std::string header;   // FoamFile header and dimensions
+    std::string boundary; // boundaryField entry and end divider
+    std::vector<NeoFOAM::scalar> values;
+    int precision = 6;
+};
+
+// formats the internal values between the staged header and boundaryField, only uses the
+// staged data, so it may run on a pool thread
+void writeStagedField(const StagedField& staged)
+{
+    std::ofstream file(staged.path, std::ios::binary);
+    file.precision(staged.precision);
+    file << staged.header << "internalField   nonuniform List<scalar> \n"
+         << staged.values.size() << "\n(\n";
+    for (const NeoFOAM::scalar value : staged.values)
+    {
+        file << value << '\n';
+    }
+    file << ")\n;\n\n" << staged.boundary;
+}
+
+}
+
 int main(int argc, char* argv[])
 {
     Kokkos::initialize(argc, argv);
@@ -39,10 +81,11 @@ int main(int argc, char* argv[])
 
 
         NeoFOAM::Dictionary controlDict = Foam::readFoamDictionary(runTime.controlDict());
-        NeoFOAM::Executor exec = createExecutor(runTime.controlDict());
+        NeoFOAM::Executor exec = createExecutor(runTime);
 
         std::unique_ptr<Foam::MeshAdapter> meshPtr = Foam::createMesh(exec, runTime);
         Foam::MeshAdapter& mesh = *meshPtr;
+        Foam::profileKernels(exec, mesh, runTime.controlDict());
 
 #include "createControl.H"
 
@@ -81,51 +124,201 @@ int main(int argc, char* argv[])
 
         Foam::scalar endTime = controlDict.get<Foam::scalar>("endTime");
 
+        Foam::ShadowValidator<Foam::volScalarField> shadow(exec, T, runTime.controlDict());
+
+        // writing and logging of a time step overlap the compute of the next time step
+        Foam::StepPipeline pipeline;
+
+        // probes and line samples of the sampling dictionary, written by the pipeline pool
+        Foam::Samplers samplers(mesh, runTime.controlDict(), &pipeline.pool());
+
+        // in-situ extracts of the extracts dictionary with their own cadence
+        Foam::Extracts extracts(mesh, runTime.controlDict(), &pipeline.pool());
+
+        // high frequency output of the timeSeries dictionary, one file per field
+        Foam::TimeSeriesOutput timeSeries(mesh, runTime.controlDict(), &pipeline.pool());
+
+        // output field of nfT, only its header and boundaryField are written from it
+        Foam::volScalarField nfTOutput(
+            Foam::IOobject(
+                "nfT",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE,
+                false
+            ),
+            mesh,
+            Foam::dimensionedScalar(Foam::dimless, 0)
+        );
+
         while (runTime.run())
         {
             Foam::scalar t = runTime.time().value();
             Foam::scalar dt = runTime.deltaT().value();
 
-            if (controlDict.get<int>("setFields"))
-            {
-                Foam::scalar pi = Foam::constant::mathematical::pi;
-                U = U0 * Foam::cos(pi * (t + 0.5 * dt) / endTime);
-                phi = phi0 * Foam::cos(pi * (t + 0.5 * dt) / endTime);
-
-                nfPhi.internalField() =
-                    nfPhi0.internalField() * std::cos(pi * (t + 0.5 * dt) / endTime);
-            }
-
-
-            std::tie(adjustTimeStep, maxCo, maxDeltaT) = timeControls(runTime);
-            coNum = calculateCoNum(phi);
-            Foam::Info << "max(phi) : " << max(phi).value() << Foam::endl;
-            Foam::Info << "max(U) : " << max(U).value() << Foam::endl;
-            if (adjustTimeStep)
-            {
-                Foam::setDeltaT(runTime, maxCo, coNum, maxDeltaT);
-            }
-            runTime++;
+            auto updateFlux = pipeline.add(
+                "updateFlux",
+                [&]()
+                {
+                    if (controlDict.get<int>("setFields"))
+                    {
+                        Foam::scalar pi = Foam::constant::mathematical::pi;
+                        U = U0 * Foam::cos(pi * (t + 0.5 * dt) / endTime);
+                        phi = phi0 * Foam::cos(pi * (t + 0.5 * dt) / endTime);
+
+                        nfPhi.internalField() =
+                            nfPhi0.internalField() * std::cos(pi * (t + 0.5 * dt) / endTime);
+                    }
+                }
+            );
 
-            Info << "Time = " << runTime.timeName() << endl;
+            auto courant = pipeline.add(
+                "courant",
+                [&]()
+                {
+                    std::tie(adjustTimeStep, maxCo, maxDeltaT) = timeControls(runTime);
+                    coNum = calculateCoNum(phi);
+                    Foam::Info << "max(phi) : " << max(phi).value() << Foam::endl;
+                    Foam::Info << "max(U) : " << max(U).value() << Foam::endl;
+                    if (adjustTimeStep)
+                    {
+                        Foam::setDeltaT(runTime, maxCo, coNum, maxDeltaT);
+                    }
+                    runTime++;
+
+                    Info << "Time = " << runTime.timeName() << endl;
+                },
+                {updateFlux}
+            );
 
+            auto solve = pipeline.add(
+                "solve",
+                [&]()
+                {
+                    if (shadow.due(runTime.timeIndex()))
+                    {
+                        // explicit upwind Euler reference step on plain copies of the
+                        // mesh and the flux, since the main loop advances both concurrently
+                        const Foam::labelList owner = mesh.owner();
+                        const Foam::labelList neighbour = mesh.neighbour();
+                        const Foam::scalarField V = mesh.V();
+                        const Foam::scalarField phiInternal = phi.primitiveField();
+                        const Foam::scalarField phiBoundary =
+                            Foam::detail::flatBoundaryField(phi);
+                        Foam::labelList faceCells(phiBoundary.size());
+                        Foam::label bfacei = 0;
+                        forAll(mesh.boundary(), patchi)
+                        {
+                            for (const Foam::label celli : mesh.boundary()[patchi].faceCells())
+                            {
+                                faceCells[bfacei++] = celli;
+                            }
+                        }
+
+                        shadow.launch(
+                            runTime.timeIndex(),
+                            nfT,
+                            [owner, neighbour, V, phiInternal, phiBoundary, faceCells, dt](
+                                Foam::scalarField& T, const Foam::scalarField& TBoundary
+                            )
+                            {
+                                Foam::scalarField divT(T.size(), Foam::Zero);
+                                forAll(phiInternal, facei)
+                                {
+                                    const Foam::scalar flux = phiInternal[facei];
+                                    const Foam::scalar faceFlux = flux
+                                                                * (flux >= 0
+                                                                       ? T[owner[facei]]
+                                                                       : T[neighbour[facei]]);
+                                    divT[owner[facei]] += faceFlux;
+                                    divT[neighbour[facei]] -= faceFlux;
+                                }
+                                forAll(phiBoundary, facei)
+                                {
+                                    const Foam::scalar flux = phiBoundary[facei];
+                                    divT[faceCells[facei]] +=
+                                        flux * (flux >= 0 ? T[faceCells[facei]] : TBoundary[facei]);
+                                }
+                                T -= dt * divT / V;
+                            }
+                        );
+                    }
+
+                    dsl::Expression eqnSys(dsl::imp::ddt(nfT) + dsl::exp::div(nfPhi, nfT));
+                    dsl::solve(eqnSys, nfT, t, dt, fvSchemesDict, fvSolutionDict);
+
+                    shadow.record(nfT);
+                    shadow.poll();
+                },
+                {courant}
+            );
 
-            {
-                dsl::Expression eqnSys(dsl::imp::ddt(nfT) + dsl::exp::div(nfPhi, nfT));
+            pipeline.add("sample", [&]() { samplers.write(nfT); }, {solve});
+            pipeline.add("extract", [&]() { extracts.write({&nfT}); }, {solve});
+            pipeline.add("timeSeries", [&]() { timeSeries.write(nfT); }, {solve});
+
+            // the nfT values are copied to a host buffer on this thread, since Info, Time and
+            // the mesh must not be used from pool threads. Formatting and writing the values
+            // overlaps the next time step
+            auto staged = std::make_shared<StagedField>();
+            auto stageOutput = pipeline.add(
+                "stageOutput",
+                [&, staged]()
+                {
+                    if (runTime.outputTime())
+                    {
+                        Info << "writing nfT field" << endl;
+                        nfTOutput.instance() = runTime.timeName();
+                        Foam::OStringStream header;
+                        nfTOutput.writeHeader(header);
+                        header.writeEntry("dimensions", nfTOutput.dimensions());
+                        header << nl;
+                        Foam::OStringStream boundary;
+                        nfTOutput.boundaryField().writeEntry("boundaryField", boundary);
+                        Foam::IOobject::writeEndDivider(boundary);
+                        Foam::mkDir(nfTOutput.path());
+
+                        auto values = nfT.internalField().copyToHost();
+                        staged->values.assign(values.span().begin(), values.span().end());
+                        staged->header = header.str();
+                        staged->boundary = boundary.str();
+                        staged->path = nfTOutput.objectPath();
+                        staged->precision = Foam::IOstream::defaultPrecision();
+                    }
+                    runTime.write();
+                },
+                {solve}
+            );
 
-                dsl::solve(eqnSys, nfT, t, dt, fvSchemesDict, fvSolutionDict);
-            }
+            pipeline.addBackground(
+                "writeNfT",
+                [staged]()
+                {
+                    if (!staged->path.empty())
+                    {
+                        writeStagedField(*staged);
+                    }
+                },
+                {stageOutput}
+            );
 
-            if (runTime.outputTime())
-            {
-                Info << "writing nfT field" << endl;
-                write(nfT.internalField(), mesh, "nfT");
-            }
+            pipeline.add(
+                "log",
+                [&runTime, &nfT]()
+                {
+                    Info << Foam::computeFieldStats(nfT);
+                    runTime.printExecutionTime(Info);
+                },
+                {stageOutput}
+            );
 
-            runTime.write();
-            runTime.printExecutionTime(Info);
+            pipeline.run();
         }
 
+        pipeline.finish();
+        shadow.finish();
+
         Info << "End\n" << endl;
     }
     Kokkos::finalize();
@@ -4,6 +4,8 @@
 /* This file implements comparison operator to compare OpenFOAM and corresponding NeoFOAM fields
  * TODO the comparison operator only make sense for testing purposes
  * so this should be part of the tets
+ * For floating point results and large fields use the FieldComparator from
+ * comparison/errorNorms.hpp which computes error norms on the executor
  */
 #pragma once
 
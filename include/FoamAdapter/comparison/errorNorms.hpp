@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+/* This file implements a comparison engine for NeoFOAM and OpenFOAM fields which computes error
+ * norms on the executor. In contrast to the equality operators in comparison.hpp, the OpenFOAM
+ * reference is uploaded once and only the resulting norms are transferred back to the host.
+ */
+#pragma once
+
+#include <span>
+#include <vector>
+#include <type_traits>
+
+#include "volFields.H"
+#include "surfaceFields.H"
+
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/core/primitives/label.hpp"
+
+#include "FoamAdapter/meshAdapter.hpp"
+#include "FoamAdapter/readers.hpp"
+#include "FoamAdapter/conversion/type_conversion.hpp"
+
+namespace Foam
+{
+
+/* @brief error norms of a field with respect to a reference field
+ *
+ * l1 and l2 are normalised by the number of entries, i.e. they correspond to the mean
+ * absolute error and the root mean square error. For vector fields the magnitude of the
+ * difference is used.
+ */
+struct ErrorNorms
+{
+    NeoFOAM::scalar l1 = 0.0;
+    NeoFOAM::scalar l2 = 0.0;
+    NeoFOAM::scalar linf = 0.0;
+    NeoFOAM::scalar maxRel = 0.0;
+    NeoFOAM::localIdx worstIdx = -1;
+    NeoFOAM::localIdx size = 0;
+};
+
+/* @brief result of a FieldComparator::compare call */
+struct ComparisonReport
+{
+    word name;
+    ErrorNorms internal;
+    ErrorNorms boundary;
+
+    //- cell (volume fields) or internal face (surface fields) with the largest error
+    label worstCell = -1;
+
+    //- patch, patch name and patch local face index with the largest boundary error
+    label worstPatch = -1;
+    word worstPatchName;
+    label worstPatchFace = -1;
+
+    scalar linf() const { return max(internal.linf, boundary.linf); }
+
+    bool within(const scalar tolerance) const { return linf() <= tolerance; }
+};
+
+Ostream& operator<<(Ostream& os, const ComparisonReport& report);
+
+/* @brief computes the error norms of values with respect to reference on the executor
+ *
+ * both spans need to reside in the memory space of exec
+ * @param relFloor lower bound of the reference magnitude used for the relative error
+ */
+template<typename ValueType>
+ErrorNorms computeErrorNorms(
+    const NeoFOAM::Executor& exec,
+    std::span<const ValueType> values,
+    std::span<const ValueType> reference,
+    const NeoFOAM::scalar relFloor = SMALL
+);
+
+namespace detail
+{
+
+/* flattens the boundary field of an OpenFOAM field into contiguous storage
+ * following the NeoFOAM patch ordering
+ */
+template<typename FoamType>
+Field<typename FoamType::value_type> flatBoundaryField(const FoamType& in)
+{
+    using foam_value_t = typename FoamType::value_type;
+    label nBoundaryFaces = 0;
+    forAll(in.boundaryField(), patchi)
+    {
+        nBoundaryFaces += in.boundaryField()[patchi].size();
+    }
+
+    Field<foam_value_t> result(nBoundaryFaces);
+    label idx = 0;
+    forAll(in.boundaryField(), patchi)
+    {
+        for (const auto& value : in.boundaryField()[patchi])
+        {
+            result[idx++] = value;
+        }
+    }
+    return result;
+}
+
+} // namespace detail
+
+/* @class FieldComparator
+ * @brief compares NeoFOAM fields against an OpenFOAM reference field
+ *
+ * The reference is uploaded to the executor on construction (or on update) so repeated
+ * comparisons against the same reference only cost a fused reduction over the field.
+ */
+template<typename FoamType>
+class FieldComparator
+{
+public:
+
+    using container_type = typename type_map<FoamType>::container_type;
+    using value_type = typename type_map<FoamType>::mapped_type;
+
+    FieldComparator(const NeoFOAM::Executor& exec, const FoamType& reference)
+        : exec_(exec)
+        , name_(reference.name())
+        , internalRef_(fromFoamField(exec, reference.primitiveField()))
+        , boundaryRef_(fromFoamField(exec, detail::flatBoundaryField(reference)))
+        , offsets_(computeOffset(reference.mesh()))
+        , patchNames_(reference.mesh().boundaryMesh().names())
+    {}
+
+    //- upload a new reference, e.g. after the OpenFOAM field has been advanced in time
+    void update(const FoamType& reference)
+    {
+        internalRef_ = fromFoamField(exec_, reference.primitiveField());
+        boundaryRef_ = fromFoamField(exec_, detail::flatBoundaryField(reference));
+    }
+
+    ComparisonReport compare(const container_type& field) const
+    {
+        const size_t nInternal = internalRef_.size();
+        const size_t nBoundary = boundaryRef_.size();
+        if constexpr (std::is_same_v<container_type, fvcc::SurfaceField<value_type>>)
+        {
+            // NeoFOAM surface fields store the boundary faces after the internal faces
+            return compare(
+                field.internalField().span({0, nInternal}),
+                field.internalField().span({nInternal, nInternal + nBoundary})
+            );
+        }
+        else
+        {
+            return compare(field.internalField().span(), field.boundaryField().value().span());
+        }
+    }
+
+    //- compare internal and flattened boundary values residing on the executor
+    ComparisonReport
+    compare(std::span<const value_type> internal, std::span<const value_type> boundary) const
+    {
+        ComparisonReport report;
+        report.name = name_;
+        report.internal = computeErrorNorms<value_type>(exec_, internal, internalRef_.span());
+        report.boundary = computeErrorNorms<value_type>(exec_, boundary, boundaryRef_.span());
+        report.worstCell = report.internal.worstIdx;
+
+        if (report.boundary.worstIdx >= 0)
+        {
+            for (size_t patchi = 0; patchi + 1 < offsets_.size(); patchi++)
+            {
+                if (report.boundary.worstIdx < offsets_[patchi + 1])
+                {
+                    report.worstPatch = patchi;
+                    report.worstPatchName = patchNames_[patchi];
+                    report.worstPatchFace = report.boundary.worstIdx - offsets_[patchi];
+                    break;
+                }
+            }
+        }
+        return report;
+    }
+
+private:
+
+    NeoFOAM::Executor exec_;
+    word name_;
+    NeoFOAM::Field<value_type> internalRef_;
+    NeoFOAM::Field<value_type> boundaryRef_;
+    std::vector<NeoFOAM::localIdx> offsets_;
+    wordList patchNames_;
+};
+
+/* @brief convenience function for a single comparison */
+template<typename FoamType>
+ComparisonReport compareFields(
+    const typename type_map<FoamType>::container_type& field,
+    const FoamType& reference
+)
+{
+    return FieldComparator<FoamType>(field.exec(), reference).compare(field);
+}
+
+} // namespace Foam
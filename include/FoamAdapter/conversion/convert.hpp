@@ -20,6 +20,9 @@ std::string convert(const Foam::word& Type);
 
 NeoFOAM::TokenList convert(const Foam::ITstream& Type);
 
+//- scalar token i of a converted stream, which is a label token for e.g. limitedLinear 1
+NeoFOAM::scalar getScalar(const NeoFOAM::TokenList& tokens, const size_t i);
+
 NeoFOAM::label convert(const Foam::label& Type);
 
 // To Foam
@@ -4,6 +4,7 @@
 
 #include "volFields.H"
 #include "surfaceFields.H"
+#include "pointFields.H"
 
 #include "NeoFOAM/finiteVolume/cellCentred.hpp"
 #include "NeoFOAM/core/executor/executor.hpp"
@@ -49,6 +50,21 @@ struct type_map<GeometricField<vector, fvsPatchField, surfaceMesh>>
     using mapped_type = NeoFOAM::Vector;
 };
 
+// point fields map to plain fields indexed like the mesh points
+template<>
+struct type_map<GeometricField<scalar, pointPatchField, pointMesh>>
+{
+    using container_type = NeoFOAM::Field<NeoFOAM::scalar>;
+    using mapped_type = NeoFOAM::scalar;
+};
+
+template<>
+struct type_map<GeometricField<vector, pointPatchField, pointMesh>>
+{
+    using container_type = NeoFOAM::Field<NeoFOAM::Vector>;
+    using mapped_type = NeoFOAM::Vector;
+};
+
 // Specializations of type_map for specific type mappings.
 template<>
 struct type_map<Field<scalar>>
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/core/primitives/label.hpp"
+#include "NeoFOAM/core/primitives/scalar.hpp"
+#include "NeoFOAM/mesh/unstructured.hpp"
+
+namespace Foam
+{
+
+/* @class EnsembleField
+ * @brief cell values of several ensemble members sharing one mesh
+ *
+ * The values are stored interleaved, i.e. the values of all members of a cell are contiguous
+ * (value of member m in cell c at c*nMembers + m). Thus a face loop processes all members
+ * with contiguous memory accesses and one launch advances the whole ensemble.
+ */
+class EnsembleField
+{
+public:
+
+    EnsembleField(
+        const NeoFOAM::Executor& exec,
+        const NeoFOAM::UnstructuredMesh& mesh,
+        const NeoFOAM::label nMembers
+    );
+
+    NeoFOAM::label nMembers() const { return nMembers_; }
+
+    const NeoFOAM::UnstructuredMesh& mesh() const { return mesh_; }
+
+    const NeoFOAM::Executor& exec() const { return exec_; }
+
+    NeoFOAM::Field<NeoFOAM::scalar>& values() { return values_; }
+
+    const NeoFOAM::Field<NeoFOAM::scalar>& values() const { return values_; }
+
+    //- set the values of one member from a cell field
+    void setMember(const NeoFOAM::label member, const NeoFOAM::Field<NeoFOAM::scalar>& cellValues);
+
+    //- extract the values of one member into a cell field
+    void getMember(const NeoFOAM::label member, NeoFOAM::Field<NeoFOAM::scalar>& cellValues) const;
+
+    /* @brief advances all members by one explicit Euler step of
+     * ddt(T) + div(fluxScale_m*faceFlux, T) = 0
+     *
+     * uses upwind interpolation and zero gradient boundaries
+     * @param faceFlux internal and boundary face fluxes shared by all members
+     * @param fluxScale per member scaling of the face flux
+     */
+    void advanceUpwind(
+        const NeoFOAM::Field<NeoFOAM::scalar>& faceFlux,
+        const NeoFOAM::Field<NeoFOAM::scalar>& fluxScale,
+        const NeoFOAM::scalar dt
+    );
+
+private:
+
+    NeoFOAM::Executor exec_;
+    const NeoFOAM::UnstructuredMesh& mesh_;
+    NeoFOAM::label nMembers_;
+    NeoFOAM::Field<NeoFOAM::scalar> values_;
+
+    //- workspace of advanceUpwind
+    NeoFOAM::Field<NeoFOAM::scalar> rhs_;
+};
+
+} // namespace Foam
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+/* This file implements in-situ visualisation extracts of NeoFOAM fields. The extract points are
+ * selected and compacted on the executor, only the points and values of the extract are copied
+ * to the host and written as VTK XML poly data with appended raw binary data by a background job.
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "boundBox.H"
+#include "dictionary.H"
+#include "pointField.H"
+#include "scalarField.H"
+
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+#include "FoamAdapter/meshAdapter.hpp"
+#include "FoamAdapter/parallel/workStealingPool.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+/* @brief points and point values of an extract on the host */
+struct ExtractData
+{
+    pointField points;
+    std::vector<std::pair<word, scalarField>> fields;
+};
+
+/* @brief writes the data as VTK XML poly data with one vertex per point
+ *
+ * the arrays are stored as appended raw binary data with 64 bit headers
+ */
+void writeVtp(const fileName& file, const ExtractData& data);
+
+/* @brief writes the parallel VTK XML index of the pieces written by each processor */
+void writePvtp(const fileName& file, const wordList& fieldNames, const fileNameList& pieces);
+
+/* @class Extract
+ * @brief a point based extract of cell fields
+ *
+ * The types are
+ *     - decimate: every stride-th cell centre, optionally within a bounding box
+ *     - slice: the cells cut by a plane, their centres projected onto the plane
+ *     - iso: the crossings of the iso value along the lines between the cell centres of the
+ *       internal faces, the other fields are linearly interpolated to the crossing
+ *
+ * i.e. the extracts are point clouds instead of triangulated surfaces which keeps the selection
+ * a single compaction on the executor.
+ */
+class Extract
+{
+public:
+
+    enum class Type
+    {
+        decimate,
+        slice,
+        iso
+    };
+
+    /* @brief creates the extract from its dictionary
+     *
+     *     type            iso;        // decimate, slice or iso
+     *     fields          (nfT);
+     *     interval        10;         // time steps between extracts
+     *
+     *     stride          8;          // decimate
+     *     box             ((0 0 0) (1 1 1));  // decimate, optional
+     *     point           (0.5 0.5 0.05);     // slice
+     *     normal          (0 0 1);            // slice
+     *     isoField        nfT;        // iso
+     *     isoValue        0.5;        // iso
+     */
+    Extract(const word& name, const MeshAdapter& mesh, const dictionary& dict);
+
+    const word& name() const { return name_; }
+
+    const wordList& fields() const { return fields_; }
+
+    bool due(const label timeIndex) const { return timeIndex % interval_ == 0; }
+
+    //- computes the extract of the fields, listed in the order of fields()
+    ExtractData
+    compute(const std::vector<const fvcc::VolumeField<NeoFOAM::scalar>*>& fields) const;
+
+private:
+
+    //- compacted cell indices of the decimate and slice extracts
+    NeoFOAM::Field<NeoFOAM::label> selectCells() const;
+
+    const MeshAdapter& mesh_;
+    word name_;
+    Type type_;
+    wordList fields_;
+    label interval_;
+
+    label stride_ = 1;
+    boundBox box_;
+    point point_;
+    vector normal_;
+    word isoField_;
+    scalar isoValue_ = 0;
+
+    //- cells of the decimate and slice extracts, the mesh is static
+    mutable std::unique_ptr<NeoFOAM::Field<NeoFOAM::label>> cells_;
+};
+
+/* @class Extracts
+ * @brief the extracts of the extracts sub dictionary
+ *
+ *     extracts
+ *     {
+ *         isoT
+ *         {
+ *             type        iso;
+ *             isoField    nfT;
+ *             isoValue    0.5;
+ *             fields      (nfT);
+ *             interval    10;
+ *         }
+ *     }
+ *
+ * The cadence of each extract is independent of the writeInterval. The extracts are written to
+ * postProcessing/extracts/<name>/<name>_<time index>.vtp, in parallel each processor writes a
+ * piece and the master the .pvtp index.
+ */
+class Extracts
+{
+public:
+
+    Extracts(const MeshAdapter& mesh, const dictionary& dict, WorkStealingPool* pool = nullptr);
+
+    bool empty() const { return extracts_.empty(); }
+
+    //- computes and writes the due extracts, fields need to contain the fields of the extracts
+    void write(const std::vector<const fvcc::VolumeField<NeoFOAM::scalar>*>& fields);
+
+private:
+
+    const MeshAdapter& mesh_;
+    WorkStealingPool* pool_;
+    std::vector<std::unique_ptr<Extract>> extracts_;
+};
+
+} // namespace Foam
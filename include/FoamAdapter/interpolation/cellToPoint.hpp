@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+#include "FoamAdapter/meshAdapter.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+/* @class CellToPointInterpolation
+ * @brief inverse distance weighted interpolation of volume fields to the mesh points
+ *
+ * The weights follow volPointInterpolation: a point on a wall or other non-empty, non-coupled
+ * patch is interpolated from the boundary values of its patch faces weighted by the inverse
+ * distance to the face centres, any other point from its cells weighted by the inverse distance
+ * to the cell centres. The weights are precomputed as a CSR matrix on the executor, the sources
+ * j of point i are sources[j] for offsets[i] <= j < offsets[i + 1] where sources below nCells
+ * are cells and the others index the flattened boundary values.
+ *
+ * Point fields are NeoFOAM::Fields indexed like the mesh points, a pointScalarField or
+ * pointVectorField is converted with fromFoamField.
+ */
+class CellToPointInterpolation
+{
+public:
+
+    explicit CellToPointInterpolation(const MeshAdapter& mesh);
+
+    label nPoints() const { return offsets_.size() - 1; }
+
+    template<typename ValueType>
+    void interpolate(const fvcc::VolumeField<ValueType>& vf, NeoFOAM::Field<ValueType>& pf) const;
+
+    template<typename ValueType>
+    NeoFOAM::Field<ValueType> interpolate(const fvcc::VolumeField<ValueType>& vf) const;
+
+private:
+
+    label nCells_;
+    NeoFOAM::Field<NeoFOAM::label> offsets_;
+    NeoFOAM::Field<NeoFOAM::label> sources_;
+    NeoFOAM::Field<NeoFOAM::scalar> weights_;
+};
+
+} // namespace Foam
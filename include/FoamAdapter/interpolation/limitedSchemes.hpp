@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+/* This file implements the limitedLinear, vanLeer and linearUpwind convection schemes of
+ * OpenFOAM as NeoFOAM surface interpolation kernels. They are registered in the
+ * SurfaceInterpolationFactory, so divSchemes entries like
+ *
+ *     div(phi,T)      Gauss limitedLinear 1;
+ *     div(phi,T)      Gauss vanLeer;
+ *     div(phi,T)      Gauss linearUpwind grad(T);
+ *
+ * converted by readFoamDictionary select them. The cell gradient is computed with Gauss linear
+ * into a field kept by the kernel, the limiter and the interpolation are then evaluated in a
+ * single face pass.
+ */
+#pragma once
+
+#include <string>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/input.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/surfaceField.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/operators/gaussGreenGrad.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+/* @brief limiter of limitedLinear k, i.e. linear for r >= k/2 and upwind for r <= 0 */
+struct LimitedLinearLimiter
+{
+    NeoFOAM::scalar twoByk;
+
+    explicit LimitedLinearLimiter(const NeoFOAM::Input& input);
+
+    static std::string name() { return "limitedLinear"; }
+
+    KOKKOS_INLINE_FUNCTION
+    NeoFOAM::scalar operator()(const NeoFOAM::scalar r) const
+    {
+        return Kokkos::max(Kokkos::min(twoByk * r, 1.0), 0.0);
+    }
+};
+
+/* @brief van Leer's limiter (r + |r|)/(1 + |r|) */
+struct VanLeerLimiter
+{
+    explicit VanLeerLimiter(const NeoFOAM::Input&) {}
+
+    static std::string name() { return "vanLeer"; }
+
+    KOKKOS_INLINE_FUNCTION
+    NeoFOAM::scalar operator()(const NeoFOAM::scalar r) const
+    {
+        return (r + Kokkos::abs(r)) / (1.0 + Kokkos::abs(r));
+    }
+};
+
+/* @class LimitedInterpolation
+ * @brief TVD scheme blending the linear and upwind weights with the limiter of the NVD/TVD
+ * gradient ratio r as OpenFOAM's LimitedScheme
+ *
+ * the face value is w phi_P + (1 - w) phi_N with w = l w_linear + (1 - l) pos0(flux)
+ */
+template<typename Limiter>
+class LimitedInterpolation :
+    public fvcc::SurfaceInterpolationFactory::Register<LimitedInterpolation<Limiter>>
+{
+    using Base = fvcc::SurfaceInterpolationFactory::Register<LimitedInterpolation<Limiter>>;
+
+public:
+
+    LimitedInterpolation(
+        const NeoFOAM::Executor& exec,
+        const NeoFOAM::UnstructuredMesh& mesh,
+        const NeoFOAM::Input& input
+    );
+
+    static std::string name() { return Limiter::name(); }
+
+    static std::string doc() { return Limiter::name() + " limited interpolation"; }
+
+    static std::string schema() { return "none"; }
+
+    //- the limited schemes require the face flux
+    void interpolate(
+        const fvcc::VolumeField<NeoFOAM::scalar>& volField,
+        fvcc::SurfaceField<NeoFOAM::scalar>& surfaceField
+    ) const override;
+
+    void interpolate(
+        const fvcc::SurfaceField<NeoFOAM::scalar>& faceFlux,
+        const fvcc::VolumeField<NeoFOAM::scalar>& volField,
+        fvcc::SurfaceField<NeoFOAM::scalar>& surfaceField
+    ) const override;
+
+    std::unique_ptr<fvcc::SurfaceInterpolationFactory> clone() const override;
+
+private:
+
+    NeoFOAM::Input input_;
+    Limiter limiter_;
+    NeoFOAM::Field<NeoFOAM::scalar> linearWeights_;
+    mutable fvcc::GaussGreenGrad grad_;
+    mutable fvcc::VolumeField<NeoFOAM::Vector> gradient_;
+};
+
+/* @class LinearUpwind
+ * @brief upwind value corrected by the extrapolation of the upwind cell gradient to the face
+ * centre as OpenFOAM's linearUpwind
+ *
+ * The gradient is always Gauss linear. The kernel only sees the NeoFOAM mesh and so cannot look
+ * up the gradSchemes entry named in the scheme, e.g. grad(T), and warns once that it is not
+ * applied.
+ */
+class LinearUpwind : public fvcc::SurfaceInterpolationFactory::Register<LinearUpwind>
+{
+    using Base = fvcc::SurfaceInterpolationFactory::Register<LinearUpwind>;
+
+public:
+
+    LinearUpwind(
+        const NeoFOAM::Executor& exec,
+        const NeoFOAM::UnstructuredMesh& mesh,
+        const NeoFOAM::Input& input
+    );
+
+    static std::string name() { return "linearUpwind"; }
+
+    static std::string doc() { return "upwind interpolation with linear correction"; }
+
+    static std::string schema() { return "none"; }
+
+    void interpolate(
+        const fvcc::VolumeField<NeoFOAM::scalar>& volField,
+        fvcc::SurfaceField<NeoFOAM::scalar>& surfaceField
+    ) const override;
+
+    void interpolate(
+        const fvcc::SurfaceField<NeoFOAM::scalar>& faceFlux,
+        const fvcc::VolumeField<NeoFOAM::scalar>& volField,
+        fvcc::SurfaceField<NeoFOAM::scalar>& surfaceField
+    ) const override;
+
+    std::unique_ptr<fvcc::SurfaceInterpolationFactory> clone() const override;
+
+private:
+
+    NeoFOAM::Input input_;
+    mutable fvcc::GaussGreenGrad grad_;
+    mutable fvcc::VolumeField<NeoFOAM::Vector> gradient_;
+};
+
+} // namespace Foam
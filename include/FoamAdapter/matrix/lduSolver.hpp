@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include "dictionary.H"
+#include "Ostream.H"
+
+#include "NeoFOAM/fields/field.hpp"
+
+#include "FoamAdapter/mesh/cellConnectivity.hpp"
+#include "FoamAdapter/matrix/lduSystem.hpp"
+
+namespace Foam
+{
+
+/* @brief residuals and iterations of a solve, printed as OpenFOAM's SolverPerformance */
+struct SolverPerformance
+{
+    word solverName;
+    word fieldName;
+    scalar initialResidual = 0;
+    scalar finalResidual = 0;
+    label nIterations = 0;
+    bool converged = false;
+};
+
+Ostream& operator<<(Ostream& os, const SolverPerformance& performance);
+
+/* @class LduSolver
+ * @brief iterative solver of an LduSystem on the executor selected by an fvSolution entry
+ *
+ * the solvers are
+ *     PCG            conjugate gradients for symmetric systems, e.g. the pressure equation
+ *     smoothSolver   Jacobi sweeps for diagonally dominant systems, e.g. the momentum equation
+ *
+ * the PCG preconditioner is always the diagonal and the smoother always Jacobi, DIC and
+ * GaussSeidel are accepted and replaced as their sweeps are sequential. The residual is normalised as in
+ * lduMatrix::solver::normFactor and the tolerance, relTol, maxIter and minIter entries have the
+ * OpenFOAM meaning. The sums are local, i.e. processor interfaces are not coupled.
+ */
+class LduSolver
+{
+public:
+
+    LduSolver(const CellConnectivity& connectivity, const dictionary& solverDict);
+
+    //- solves the system for x starting from the current values of x
+    SolverPerformance
+    solve(const LduSystem& system, NeoFOAM::Field<NeoFOAM::scalar>& x, const word& fieldName)
+        const;
+
+private:
+
+    const CellConnectivity& connectivity_;
+    word solverName_;
+    scalar tolerance_;
+    scalar relTol_;
+    label maxIter_;
+    label minIter_;
+
+    bool converged(const SolverPerformance& performance) const;
+
+    void pcg(
+        const LduSystem& system,
+        NeoFOAM::Field<NeoFOAM::scalar>& x,
+        NeoFOAM::scalar normFactor,
+        SolverPerformance& performance
+    ) const;
+
+    void jacobi(
+        const LduSystem& system,
+        NeoFOAM::Field<NeoFOAM::scalar>& x,
+        NeoFOAM::scalar normFactor,
+        SolverPerformance& performance
+    ) const;
+};
+
+} // namespace Foam
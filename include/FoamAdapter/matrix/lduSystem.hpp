@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/mesh/unstructured.hpp"
+
+#include "FoamAdapter/mesh/cellConnectivity.hpp"
+
+namespace Foam
+{
+
+/* @class LduSystem
+ * @brief linear system A x = source in the lower diagonal upper format of OpenFOAM's lduMatrix
+ *
+ * upper and lower are the coefficients of the internal faces, i.e. row owner column neighbour
+ * and row neighbour column owner of the mesh addressing. Unlike the fvMatrix the boundary
+ * contributions are included in diag and source.
+ */
+struct LduSystem
+{
+    //- a zero system of the mesh on the mesh executor
+    explicit LduSystem(const NeoFOAM::UnstructuredMesh& mesh);
+
+    NeoFOAM::Field<NeoFOAM::scalar> diag;
+    NeoFOAM::Field<NeoFOAM::scalar> lower;
+    NeoFOAM::Field<NeoFOAM::scalar> upper;
+    NeoFOAM::Field<NeoFOAM::scalar> source;
+};
+
+/* @brief Ax = A x as lduMatrix::Amul, gathered per cell through the connectivity */
+void Amul(
+    const CellConnectivity& connectivity,
+    const LduSystem& system,
+    const NeoFOAM::Field<NeoFOAM::scalar>& x,
+    NeoFOAM::Field<NeoFOAM::scalar>& Ax
+);
+
+/* @brief fixes the level of a singular system as fvMatrix::setReference
+ *
+ * does nothing for a negative cell, i.e. if the reference cell is on another processor
+ */
+void setReference(LduSystem& system, const NeoFOAM::label celli, const NeoFOAM::scalar value);
+
+/* @brief implicit under-relaxation with the factor alpha
+ *
+ * the diagonal is divided by alpha and the difference times the current solution psi is added
+ * to the source. Unlike fvMatrix::relax the diagonal dominance is not enforced.
+ */
+void relax(
+    LduSystem& system, const NeoFOAM::Field<NeoFOAM::scalar>& psi, const NeoFOAM::scalar alpha
+);
+
+} // namespace Foam
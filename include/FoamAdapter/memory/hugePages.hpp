@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <cstddef>
+
+#include "dictionary.H"
+#include "Ostream.H"
+
+namespace Foam
+{
+
+/* @brief huge page policy for the host allocations made by the adapter
+ *
+ * transparent advises the kernel to back the mesh and field arrays converted by
+ * fromFoamField with transparent huge pages before they are first touched. This reduces
+ * the TLB misses of the indirect accesses in face loops on large meshes.
+ */
+enum class HugePagePolicy
+{
+    none,
+    transparent
+};
+
+void setHugePagePolicy(const HugePagePolicy policy, const size_t minBytes);
+
+HugePagePolicy hugePagePolicy();
+
+/* @brief sets the policy from the hugePages sub dictionary
+ *
+ *     hugePages
+ *     {
+ *         policy      transparent;  // none or transparent
+ *         minSize     4194304;      // smallest allocation in bytes to advise
+ *     }
+ */
+void readHugePagePolicy(const dictionary& controlDict);
+
+/* @brief summary of the huge page usage of the process */
+struct HugePageReport
+{
+    //- transparent huge page mode of the kernel, e.g. always, madvise or never
+    word mode;
+
+    //- bytes advised by the adapter
+    size_t advisedBytes = 0;
+
+    //- anonymous memory of the process backed by huge pages
+    size_t anonHugePagesBytes = 0;
+};
+
+HugePageReport hugePageReport();
+
+Ostream& operator<<(Ostream& os, const HugePageReport& report);
+
+namespace detail
+{
+
+//- advises the huge page aligned part of a host allocation according to the policy
+void adviseHugePages(void* ptr, const size_t nBytes);
+
+} // namespace detail
+
+} // namespace Foam
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/mesh/unstructured.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/surfaceField.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+/* @class CellConnectivity
+ * @brief cell to face and cell to cell connectivity in compressed sparse row format
+ *
+ * the faces of cell i, including its boundary faces, are faces[j] for
+ * offsets[i] <= j < offsets[i + 1] in ascending order. The faces are numbered as in the surface
+ * fields, i.e. the boundary faces follow the internal faces without the empty patches. cells[j]
+ * is the cell on the other side of the face or -1 for a boundary face and signs[j] is 1 if cell
+ * i owns the face and -1 if it is the neighbour. Cell based operators gather the face
+ * contributions of a cell through this connectivity instead of scattering each face to its
+ * owner and neighbour with atomics.
+ */
+struct CellConnectivity
+{
+    NeoFOAM::Field<NeoFOAM::label> offsets;
+    NeoFOAM::Field<NeoFOAM::label> faces;
+    NeoFOAM::Field<NeoFOAM::label> cells;
+    NeoFOAM::Field<NeoFOAM::scalar> signs;
+};
+
+/* @brief builds the connectivity from the face owner and neighbour on the mesh executor */
+CellConnectivity computeCellConnectivity(const NeoFOAM::UnstructuredMesh& mesh);
+
+/* @brief the divergence of faceFlux * faceValues, i.e. GaussGreenDiv with the face values
+ * interpolated beforehand, computed per cell without atomics
+ *
+ * the face contributions of each cell are summed in ascending face order, so the result is
+ * independent of the executor and the number of threads
+ */
+void gatherDiv(
+    const CellConnectivity& connectivity,
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const fvcc::SurfaceField<NeoFOAM::scalar>& faceFlux,
+    const fvcc::SurfaceField<NeoFOAM::scalar>& faceValues,
+    fvcc::VolumeField<NeoFOAM::scalar>& divPhi
+);
+
+} // namespace Foam
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/mesh/unstructured.hpp"
+
+namespace Foam
+{
+
+/* @class NonOrthGeometry
+ * @brief the non-orthogonal delta coefficients and correction vectors of the faces
+ *
+ * the faces are numbered as in the surface fields, i.e. the boundary faces follow the internal
+ * faces without the empty patches. With d the vector between the cell centres, or the patch delta
+ * on the boundary, and n the unit face normal the entries match surfaceInterpolation
+ *
+ *     deltaCoeffs          1/max(n & d, 0.05 |d|)
+ *     correctionVectors    n - deltaCoeffs d
+ *
+ * The correction vectors of the non-coupled patches vanish as their delta is parallel to n.
+ */
+struct NonOrthGeometry
+{
+    NeoFOAM::Field<NeoFOAM::scalar> deltaCoeffs;
+    NeoFOAM::Field<NeoFOAM::Vector> correctionVectors;
+};
+
+/* @brief computes the geometry of all faces in one pass on the mesh executor */
+NonOrthGeometry computeNonOrthGeometry(const NeoFOAM::UnstructuredMesh& mesh);
+
+/* @brief the linear interpolation weights of the owner values of the internal faces as
+ * surfaceInterpolation::makeWeights */
+NeoFOAM::Field<NeoFOAM::scalar> computeLinearWeights(const NeoFOAM::UnstructuredMesh& mesh);
+
+} // namespace Foam
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include "fvMesh.H"
 
@@ -14,6 +15,8 @@
 #include "NeoFOAM/mesh/unstructured.hpp"
 
 #include "readers.hpp"
+#include "FoamAdapter/mesh/cellConnectivity.hpp"
+#include "FoamAdapter/mesh/nonOrthGeometry.hpp"
 
 namespace Foam
 {
@@ -27,6 +30,14 @@ FieldT flatBCField(const fvMesh& mesh, std::function<FieldT(const fvPatch&)> f);
 
 NeoFOAM::UnstructuredMesh readOpenFOAMMesh(const NeoFOAM::Executor exec, const fvMesh& mesh);
 
+/* @brief computes a hash of the mesh points and topology
+ *
+ * hashes the points, the point lists of the faces, owner/neighbour and the patch layout. The
+ * hash identifies a mesh independent of the case location, e.g. to cache mesh dependent
+ * decisions or to tag output files
+ */
+uint64_t computeMeshHash(const polyMesh& mesh);
+
 /** @class MeshAdapter
  */
 class MeshAdapter : public fvMesh
@@ -34,6 +45,12 @@ class MeshAdapter : public fvMesh
 
     NeoFOAM::UnstructuredMesh nfMesh_;
 
+    //- non-orthogonal face geometry of nfMesh_, computed with the conversion
+    NonOrthGeometry nonOrthGeometry_;
+
+    //- demand driven cell to face connectivity of nfMesh_
+    mutable std::unique_ptr<CellConnectivity> cellConnectivity_;
+
     // Private Member Functions
 
     //- No copy construct
@@ -91,6 +108,20 @@ public:
     const NeoFOAM::UnstructuredMesh& nfMesh() const { return nfMesh_; }
 
     const NeoFOAM::Executor exec() const { return nfMesh().exec(); }
+
+    const NonOrthGeometry& nonOrthGeometry() const { return nonOrthGeometry_; }
+
+    //- cell to face and cell to cell connectivity, built on first access
+    const CellConnectivity& cellConnectivity() const;
+
+    //- clears the OpenFOAM geometry and derived addressing duplicated by nfMesh,
+    //  called by the constructors if releaseFoamStorage() is set. The points, faces and
+    //  owner/neighbour stay duplicated and any later use of the OpenFOAM geometry, e.g.
+    //  C(), Sf() or fvc operators, computes the cleared arrays again
+    void clearFoamStorage();
+
+    //- bytes held by the demand driven OpenFOAM geometry and cell addressing
+    size_t foamGeometryBytes() const;
 };
 
 } // End namespace Foam
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+/* This file implements the monitoring of NeoFOAM fields. The statistics are computed by fused
+ * reductions on the executor and only the resulting scalars (and histogram bins) are transferred
+ * to the host and reduced over all processors.
+ */
+#pragma once
+
+#include <span>
+
+#include "labelField.H"
+#include "Ostream.H"
+
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+/* @brief bins of an optional histogram
+ *
+ * without a range, i.e. min >= max, the global range of the field is used which requires a
+ * second pass over the field
+ */
+struct HistogramBins
+{
+    label nBins = 0;
+    scalar min = 0;
+    scalar max = 0;
+};
+
+/* @brief global statistics of a cell field
+ *
+ * For vector fields the statistics of the magnitude are computed. The histogram counts values
+ * outside the range in the first and last bin and NaN in the first bin.
+ */
+struct FieldStats
+{
+    word name;
+    scalar min = 0;
+    scalar max = 0;
+    scalar sum = 0;
+    scalar volume = 0;
+
+    //- volume weighted mean
+    scalar mean = 0;
+    label size = 0;
+
+    scalar histogramMin = 0;
+    scalar histogramMax = 0;
+    labelField histogram;
+};
+
+Ostream& operator<<(Ostream& os, const FieldStats& stats);
+
+/* @brief computes the statistics of values weighted by volumes on the executor
+ *
+ * both spans need to reside in the memory space of exec
+ */
+template<typename ValueType>
+FieldStats computeFieldStats(
+    const NeoFOAM::Executor& exec,
+    std::span<const ValueType> values,
+    std::span<const NeoFOAM::scalar> volumes,
+    const HistogramBins& bins = {}
+);
+
+/* @brief computes the statistics of the internal field */
+template<typename ValueType>
+FieldStats
+computeFieldStats(const fvcc::VolumeField<ValueType>& field, const HistogramBins& bins = {})
+{
+    FieldStats stats = computeFieldStats<ValueType>(
+        field.exec(),
+        field.internalField().span(),
+        field.mesh().cellVolumes().span(),
+        bins
+    );
+    stats.name = field.name;
+    return stats;
+}
+
+} // namespace Foam
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+/* This file implements probes and line and plane samplers for NeoFOAM fields. The sample
+ * stencils are computed once on construction, each sample gathers the values on the executor
+ * and only the sampled values are copied to the host and written by a background job.
+ */
+#pragma once
+
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dictionary.H"
+#include "pointField.H"
+
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+#include "FoamAdapter/meshAdapter.hpp"
+#include "FoamAdapter/parallel/workStealingPool.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+/* @brief sample stencils in compressed row storage
+ *
+ * the value of sample i is the sum of weights[j] * cellValues[cells[j]] for
+ * offsets[i] <= j < offsets[i + 1]
+ */
+struct SampleStencil
+{
+    NeoFOAM::Field<NeoFOAM::label> offsets;
+    NeoFOAM::Field<NeoFOAM::label> cells;
+    NeoFOAM::Field<NeoFOAM::scalar> weights;
+};
+
+/* @class SampleSet
+ * @brief values of cell fields at a set of points
+ *
+ * Each point is sampled by the lowest processor containing it, points outside the mesh are
+ * dropped with a warning. The interpolation is either
+ *     - cell: the value of the cell containing the point
+ *     - inverseDistance: inverse distance weighting of the cell containing the point and its
+ *       face neighbours
+ */
+class SampleSet
+{
+public:
+
+    enum class Interpolation
+    {
+        cell,
+        inverseDistance
+    };
+
+    SampleSet(
+        const word& name,
+        const MeshAdapter& mesh,
+        const pointField& points,
+        const Interpolation interpolation = Interpolation::cell
+    );
+
+    /* @brief creates a sample set from a dictionary
+     *
+     *     probes1
+     *     {
+     *         type            probes;
+     *         points          ((0.5 0.5 0.05) (0.25 0.5 0.05));
+     *     }
+     *     line1
+     *     {
+     *         type            line;
+     *         start           (0 0.5 0.05);
+     *         end             (1 0.5 0.05);
+     *         nPoints         100;
+     *     }
+     *     plane1
+     *     {
+     *         type            plane;
+     *         origin          (0 0 0.05);
+     *         e1              (1 0 0);     // spans the plane, the length is the extent
+     *         e2              (0 1 0);
+     *         nPoints         (50 50);
+     *     }
+     *
+     * with the optional entry interpolation (cell or inverseDistance)
+     */
+    static std::unique_ptr<SampleSet>
+    New(const word& name, const MeshAdapter& mesh, const dictionary& dict);
+
+    const word& name() const { return name_; }
+
+    //- the points sampled on any processor
+    const pointField& points() const { return points_; }
+
+    //- values at the points of this processor on the executor of cellValues
+    template<typename ValueType>
+    NeoFOAM::Field<ValueType> gather(const NeoFOAM::Field<ValueType>& cellValues) const;
+
+    //- values at all points on all processors
+    template<typename ValueType>
+    std::vector<ValueType> sample(const fvcc::VolumeField<ValueType>& field) const;
+
+private:
+
+    word name_;
+    pointField points_;
+
+    //- index in points_ of the points sampled by this processor
+    labelList localPoints_;
+
+    SampleStencil stencil_;
+};
+
+/* @class SampleWriter
+ * @brief appends rows of sampled values to a file in the format of the OpenFOAM probes
+ *
+ * The rows are formatted by the calling thread. With a pool the formatted bytes are written
+ * with std::ofstream by a background job, the rows stay in order as each job writes all rows
+ * appended before it. A failed background write is reported by the next append or flush.
+ */
+class SampleWriter
+{
+public:
+
+    SampleWriter(const fileName& file, const pointField& points, WorkStealingPool* pool = nullptr);
+
+    SampleWriter(const SampleWriter&) = delete;
+
+    void operator=(const SampleWriter&) = delete;
+
+    //- writes the remaining rows
+    ~SampleWriter();
+
+    void append(const scalar time, std::string row);
+
+    void flush();
+
+private:
+
+    struct State
+    {
+        std::mutex rowsMutex;  // guards rows
+        std::mutex writeMutex; // keeps the rows of concurrent flushes in order
+        std::ofstream os;
+        std::string rows; // formatted rows not yet written
+        std::atomic<bool> failed = false;
+
+        explicit State(const fileName& file) : os(file, std::ios::binary) {}
+
+        //- writes the formatted rows, only uses the staged bytes and the stream
+        void flush();
+    };
+
+    //- raises a FatalError if a write has failed
+    void checkState() const;
+
+    fileName file_;
+    std::shared_ptr<State> state_;
+    WorkStealingPool* pool_;
+};
+
+/* @class Samplers
+ * @brief the sample sets of the sampling sub dictionary and their writers
+ *
+ *     sampling
+ *     {
+ *         probes1
+ *         {
+ *             type            probes;
+ *             points          ((0.5 0.5 0.05));
+ *             fields          (T);
+ *         }
+ *     }
+ *
+ * the values are written to postProcessing/<set>/<start time>/<field>
+ */
+class Samplers
+{
+public:
+
+    Samplers(const MeshAdapter& mesh, const dictionary& dict, WorkStealingPool* pool = nullptr);
+
+    bool empty() const { return sets_.empty(); }
+
+    //- samples the field with all sets listing it and appends the values at the current time
+    template<typename ValueType>
+    void write(const fvcc::VolumeField<ValueType>& field);
+
+private:
+
+    SampleWriter& writer(const SampleSet& set, const word& fieldName);
+
+    const MeshAdapter& mesh_;
+    WorkStealingPool* pool_;
+    std::vector<std::unique_ptr<SampleSet>> sets_;
+    std::vector<wordList> fields_;
+    std::map<std::pair<word, word>, std::unique_ptr<SampleWriter>> writers_;
+};
+
+} // namespace Foam
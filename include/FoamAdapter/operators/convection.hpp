@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include "NeoFOAM/core/tokenList.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/surfaceField.hpp"
+
+#include "FoamAdapter/meshAdapter.hpp"
+#include "FoamAdapter/matrix/lduSystem.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+/* @class Convection
+ * @brief implicit Gauss convection of a scalar volume field by a face flux as OpenFOAM's
+ * gaussConvectionScheme::fvmDiv
+ *
+ * The scheme is a divSchemes entry, Gauss upwind or Gauss linear. An internal face with the
+ * flux F and the weight w of the owner value contributes lower = -w F and upper = (1 - w) F,
+ * the diagonal is the negative sum of the coefficients of its column as in negSumDiag. The
+ * boundary faces use the valueInternalCoeffs and valueBoundaryCoeffs of a mixed condition.
+ */
+class Convection
+{
+public:
+
+    Convection(const MeshAdapter& mesh, const NeoFOAM::TokenList& scheme);
+
+    //- adds the coefficients of fvm::div(faceFlux, phi) to the system
+    void assemble(
+        const fvcc::SurfaceField<NeoFOAM::scalar>& faceFlux,
+        const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+        LduSystem& system
+    ) const;
+
+private:
+
+    const MeshAdapter& mesh_;
+    bool upwind_;
+    NeoFOAM::Field<NeoFOAM::scalar> linearWeights_;
+};
+
+} // namespace Foam
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <memory>
+
+#include "NeoFOAM/core/tokenList.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/operators/gaussGreenGrad.hpp"
+
+#include "FoamAdapter/meshAdapter.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+/* @class GradScheme
+ * @brief gradient of a scalar volume field on the executor selected like OpenFOAM's gradScheme
+ *
+ * the schemes are
+ *     Gauss linear
+ *     leastSquares
+ *     cellLimited <scheme> <k>
+ *     faceLimited <scheme> <k>
+ */
+class GradScheme
+{
+public:
+
+    virtual ~GradScheme() = default;
+
+    //- computes the internal field of gradPhi, the boundary field is left to the caller
+    virtual void grad(
+        const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+        fvcc::VolumeField<NeoFOAM::Vector>& gradPhi
+    ) const = 0;
+
+    //- selects the scheme from a gradSchemes entry converted with convert(ITstream)
+    static std::unique_ptr<GradScheme>
+    New(const MeshAdapter& mesh, const NeoFOAM::TokenList& scheme);
+
+    //- selects the scheme of the gradSchemes entry of name in the fvSchemes of the mesh
+    static std::unique_ptr<GradScheme> New(const MeshAdapter& mesh, const word& name);
+};
+
+/* @brief a gradient field with calculated boundaries, e.g. the cell gradient kept by a scheme */
+fvcc::VolumeField<NeoFOAM::Vector>
+gradientField(const NeoFOAM::Executor& exec, const NeoFOAM::UnstructuredMesh& mesh);
+
+/* @class GaussGrad
+ * @brief GaussGreenGrad with linear interpolation as GradScheme */
+class GaussGrad : public GradScheme
+{
+public:
+
+    explicit GaussGrad(const MeshAdapter& mesh);
+
+    void grad(
+        const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+        fvcc::VolumeField<NeoFOAM::Vector>& gradPhi
+    ) const override;
+
+private:
+
+    mutable fvcc::GaussGreenGrad grad_;
+};
+
+} // namespace Foam
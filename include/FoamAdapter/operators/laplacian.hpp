@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "NeoFOAM/core/tokenList.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/surfaceField.hpp"
+
+#include "FoamAdapter/meshAdapter.hpp"
+#include "FoamAdapter/matrix/lduSystem.hpp"
+#include "FoamAdapter/operators/gradScheme.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+/* @class SnGrad
+ * @brief surface normal gradient of a scalar volume field selected like OpenFOAM's snGradScheme
+ *
+ * the schemes are
+ *     corrected      nonOrthDeltaCoeffs (phi_N - phi_P) + correctionVectors & linear(grad(phi))
+ *     uncorrected    nonOrthDeltaCoeffs (phi_N - phi_P)
+ *
+ * with the geometry of MeshAdapter::nonOrthGeometry. The gradient of the correction is selected
+ * from the gradSchemes entry grad(<name of phi>). The boundary faces take
+ * nonOrthDeltaCoeffs (phi_B - phi_P), which is the patch snGrad of the fixedValue and the
+ * fixedGradient conditions, and are not corrected as the correction vectors of non-coupled
+ * patches vanish.
+ */
+class SnGrad
+{
+public:
+
+    //- scheme is an snGradSchemes entry converted with convert(ITstream)
+    SnGrad(const MeshAdapter& mesh, const NeoFOAM::TokenList& scheme);
+
+    bool corrected() const { return corrected_; }
+
+    //- the internal field of snGradPhi including the boundary faces
+    void snGrad(
+        const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+        fvcc::SurfaceField<NeoFOAM::scalar>& snGradPhi
+    ) const;
+
+    //- the non-orthogonal correction of each face, zero if uncorrected
+    void correction(
+        const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+        NeoFOAM::Field<NeoFOAM::scalar>& faceCorrection
+    ) const;
+
+private:
+
+    const MeshAdapter& mesh_;
+    bool corrected_;
+    mutable std::map<std::string, std::unique_ptr<GradScheme>> gradSchemes_;
+    mutable fvcc::VolumeField<NeoFOAM::Vector> gradient_;
+};
+
+/* @class Laplacian
+ * @brief Gauss Laplacian of a scalar volume field with a face diffusivity as OpenFOAM's
+ * gaussLaplacianScheme
+ *
+ * The scheme is a laplacianSchemes entry, e.g. Gauss linear corrected, of which the snGrad
+ * scheme is used. The diffusivity is given on the faces, so the interpolation scheme has no
+ * effect. The face contributions of each cell are gathered through MeshAdapter::cellConnectivity
+ * without atomics.
+ */
+class Laplacian
+{
+public:
+
+    Laplacian(const MeshAdapter& mesh, const NeoFOAM::TokenList& scheme);
+
+    //- lapPhi = 1/V sum gamma |Sf| snGrad(phi), i.e. fvc::laplacian
+    void laplacian(
+        const fvcc::SurfaceField<NeoFOAM::scalar>& gamma,
+        const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+        fvcc::VolumeField<NeoFOAM::scalar>& lapPhi
+    ) const;
+
+    /* @brief adds the coefficients of fvm::laplacian to the system
+     *
+     * the boundary coefficients follow from the value fraction, reference value and reference
+     * gradient of the boundary field as for a mixed condition, the explicit non-orthogonal
+     * correction is added to the source. The coefficients are multiplied by scale, e.g. -1 for
+     * a diffusion term on the left hand side of a transport equation.
+     */
+    void assemble(
+        const fvcc::SurfaceField<NeoFOAM::scalar>& gamma,
+        const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+        LduSystem& system,
+        const NeoFOAM::scalar scale = 1.0
+    ) const;
+
+private:
+
+    const MeshAdapter& mesh_;
+    SnGrad snGrad_;
+    mutable NeoFOAM::Field<NeoFOAM::scalar> faceCorrection_;
+};
+
+} // namespace Foam
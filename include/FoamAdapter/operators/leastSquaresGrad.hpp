@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+#include "FoamAdapter/meshAdapter.hpp"
+#include "FoamAdapter/operators/gradScheme.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+/* @class LeastSquaresGrad
+ * @brief least squares gradient with the weights of OpenFOAM's leastSquaresVectors
+ *
+ * The weight vectors of each cell face, i.e. the inverse of the cell's least squares matrix
+ * applied to the face delta, are computed once and stored in the order of the cell
+ * connectivity on the executor. A gradient evaluation is then a single gather pass
+ *
+ *     grad(phi)_P = sum_f w_f (phi_f - phi_P)
+ *
+ * with phi_f the neighbour cell value of internal faces and the boundary value of boundary
+ * faces. Coupled patches use their boundary values instead of the neighbour cell values.
+ */
+class LeastSquaresGrad : public GradScheme
+{
+public:
+
+    explicit LeastSquaresGrad(const MeshAdapter& mesh);
+
+    void grad(
+        const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+        fvcc::VolumeField<NeoFOAM::Vector>& gradPhi
+    ) const override;
+
+    //- weight vectors in the order of the cell connectivity
+    const NeoFOAM::Field<NeoFOAM::Vector>& weights() const { return weights_; }
+
+private:
+
+    const CellConnectivity& connectivity_;
+    NeoFOAM::label nInternalFaces_;
+    NeoFOAM::Field<NeoFOAM::Vector> weights_;
+};
+
+} // namespace Foam
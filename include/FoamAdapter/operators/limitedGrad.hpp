@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <map>
+#include <memory>
+
+#include "FoamAdapter/operators/gradScheme.hpp"
+
+namespace Foam
+{
+
+/* @class CellLimitedGrad
+ * @brief limits the gradient of the basic scheme with OpenFOAM's cellLimited minmod limiter
+ *
+ * The gradient is scaled such that the extrapolation to the face centres of a cell stays within
+ * the minimum and maximum of the cell and its neighbours, widened by (1/k - 1) times their
+ * range for k < 1. The neighbour minimum and maximum, the limiter and the scaling are fused into
+ * a single gather pass over the cell connectivity after the basic gradient.
+ */
+class CellLimitedGrad : public GradScheme
+{
+public:
+
+    CellLimitedGrad(const MeshAdapter& mesh, std::unique_ptr<GradScheme> basicGrad, const scalar k);
+
+    void grad(
+        const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+        fvcc::VolumeField<NeoFOAM::Vector>& gradPhi
+    ) const override;
+
+private:
+
+    const MeshAdapter& mesh_;
+    std::unique_ptr<GradScheme> basicGrad_;
+    scalar k_;
+};
+
+/* @class FaceLimitedGrad
+ * @brief limits the gradient of the basic scheme with OpenFOAM's faceLimited limiter
+ *
+ * The extrapolation to each face centre is bounded by the values on both sides of the face.
+ * As in OpenFOAM, boundary faces are only considered on fixed value patches. These are taken
+ * from the OpenFOAM field of the same name registered on the mesh, without one no boundary face
+ * is considered.
+ */
+class FaceLimitedGrad : public GradScheme
+{
+public:
+
+    FaceLimitedGrad(const MeshAdapter& mesh, std::unique_ptr<GradScheme> basicGrad, const scalar k);
+
+    void grad(
+        const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+        fvcc::VolumeField<NeoFOAM::Vector>& gradPhi
+    ) const override;
+
+private:
+
+    //- 1 for the boundary faces of fixed value patches of the field
+    const NeoFOAM::Field<NeoFOAM::label>& fixesValue(const std::string& name) const;
+
+    const MeshAdapter& mesh_;
+    std::unique_ptr<GradScheme> basicGrad_;
+    scalar k_;
+    mutable std::map<std::string, NeoFOAM::Field<NeoFOAM::label>> fixesValue_;
+};
+
+} // namespace Foam
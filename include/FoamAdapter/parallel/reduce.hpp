@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <string>
+#include <utility>
+#include <variant>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/core/primitives/label.hpp"
+
+namespace Foam
+{
+
+namespace detail
+{
+
+template<typename ExecSpace, typename Kernel, typename... Reducers>
+void parallelReduceOn(
+    const std::string& name,
+    std::pair<size_t, size_t> range,
+    const Kernel& kernel,
+    Reducers... reducers
+)
+{
+    auto [start, end] = range;
+    Kokkos::parallel_reduce(name, Kokkos::RangePolicy<ExecSpace>(start, end), kernel, reducers...);
+}
+
+/* @brief Runs a Kokkos reduction with one or several reducers on the execution space of the
+ * given executor.
+ *
+ * NeoFOAM::parallelReduce only supports a single sum, this overload allows fusing several
+ * reductions (e.g. Sum, Max and MaxLoc) into a single pass over the data. The kernel receives
+ * one reference per reducer.
+ */
+template<typename Kernel, typename... Reducers>
+void parallelReduce(
+    const NeoFOAM::Executor& exec,
+    const std::string& name,
+    std::pair<size_t, size_t> range,
+    const Kernel& kernel,
+    Reducers... reducers
+)
+{
+    std::visit(
+        [&](const auto& e)
+        {
+            using ExecSpace = typename std::remove_cvref_t<decltype(e)>::exec;
+            parallelReduceOn<ExecSpace>(name, range, kernel, reducers...);
+        },
+        exec
+    );
+}
+
+template<typename ExecSpace, typename Kernel>
+NeoFOAM::label
+parallelScanOn(const std::string& name, std::pair<size_t, size_t> range, const Kernel& kernel)
+{
+    auto [start, end] = range;
+    NeoFOAM::label total = 0;
+    Kokkos::parallel_scan(name, Kokkos::RangePolicy<ExecSpace>(start, end), kernel, total);
+    return total;
+}
+
+/* @brief Runs a Kokkos exclusive scan on the execution space of the given executor and returns
+ * the total.
+ *
+ * The kernel has the signature (i, NeoFOAM::label& partial, const bool final), e.g. to compact
+ * the indices of selected entries by writing them at partial in the final pass.
+ */
+template<typename Kernel>
+NeoFOAM::label parallelScan(
+    const NeoFOAM::Executor& exec,
+    const std::string& name,
+    std::pair<size_t, size_t> range,
+    const Kernel& kernel
+)
+{
+    return std::visit(
+        [&](const auto& e)
+        {
+            using ExecSpace = typename std::remove_cvref_t<decltype(e)>::exec;
+            return parallelScanOn<ExecSpace>(name, range, kernel);
+        },
+        exec
+    );
+}
+
+} // namespace detail
+
+} // namespace Foam
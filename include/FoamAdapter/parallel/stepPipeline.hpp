@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "label.H"
+#include "word.H"
+
+#include "FoamAdapter/parallel/workStealingPool.hpp"
+
+namespace Foam
+{
+
+/* @class StepPipeline
+ * @brief executes the tasks of a time step as a dependency graph and overlaps the output of
+ * a step with the compute of the next step
+ *
+ * Each time step adds its tasks, e.g. flux update, Courant number, solve, output staging,
+ * writing and logging, and calls run(). Foreground tasks are executed by the calling thread
+ * in the order of their dependencies, so all device kernels are launched from the thread
+ * that initialised Kokkos. Background tasks, e.g. writing or logging of staged data, are
+ * executed by a work stealing pool once their dependencies have finished. run() returns after
+ * the foreground tasks, i.e. the background tasks of step n overlap the compute of step
+ * n + 1. Background tasks with the same name are executed in the order of the time steps,
+ * thus a step is written only after the previous one.
+ *
+ * Background tasks must only use data staged for them by a foreground task, since the
+ * foreground of the next step modifies the fields. They run concurrently with the next step,
+ * so they must not use Info, the Time or the mesh, and must not construct OpenFOAM objects,
+ * e.g. a foreground task copies the field values to a host buffer which a background task
+ * formats and writes with std::ofstream. Logging with Info thus stays in the foreground.
+ */
+class StepPipeline
+{
+public:
+
+    using TaskId = label;
+    using Task = std::function<void()>;
+
+    enum class Stage
+    {
+        foreground,
+        background
+    };
+
+    explicit StepPipeline(const label nThreads = 0);
+
+    StepPipeline(const StepPipeline&) = delete;
+
+    void operator=(const StepPipeline&) = delete;
+
+    ~StepPipeline();
+
+    //- adds a task of the current step that starts after its dependencies
+    TaskId add(
+        const word& name,
+        Task task,
+        const std::vector<TaskId>& dependencies = {},
+        const Stage stage = Stage::foreground
+    );
+
+    TaskId addBackground(const word& name, Task task, const std::vector<TaskId>& dependencies = {})
+    {
+        return add(name, std::move(task), dependencies, Stage::background);
+    }
+
+    //- runs the foreground tasks of the current step and starts its background tasks
+    void run();
+
+    //- waits for all background tasks, e.g. before the end of the run
+    void finish();
+
+    WorkStealingPool& pool() { return pool_; }
+
+private:
+
+    struct Node
+    {
+        word name;
+        Task task;
+        Stage stage;
+        std::vector<TaskId> dependencies;
+
+        std::mutex mutex;
+        bool done = false;
+        std::vector<std::shared_ptr<Node>> successors;
+        std::atomic<label> nWaiting = 0;
+    };
+
+    //- registers succ to start after pred, if pred has not finished yet
+    static void addEdge(const std::shared_ptr<Node>& pred, const std::shared_ptr<Node>& succ);
+
+    void launch(const std::shared_ptr<Node>& node);
+
+    void rethrow();
+
+    WorkStealingPool pool_;
+    std::vector<std::shared_ptr<Node>> step_;
+    std::map<word, std::shared_ptr<Node>> lastBackground_;
+
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+};
+
+} // namespace Foam
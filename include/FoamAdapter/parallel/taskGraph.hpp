@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "label.H"
+#include "word.H"
+
+namespace Foam
+{
+
+/* @brief passed to each task of a TaskGraph
+ *
+ * space is the host execution space partition reserved for the task, kernels launched on it
+ * run concurrently to the kernels of the other tasks of the same wave
+ */
+struct TaskContext
+{
+    label taskId;
+    word name;
+    Kokkos::DefaultHostExecutionSpace space;
+};
+
+/* @class TaskGraph
+ * @brief runs independent tasks, e.g. explicit solves of several scalars, concurrently
+ *
+ * Tasks are added with the ids of the tasks they depend on, thus the graph is acyclic by
+ * construction. run() groups the tasks into waves of mutually independent tasks. The tasks
+ * of a wave are executed on separate host threads, each with its own partition of the host
+ * execution space, and run() returns once all tasks have finished. The time step is
+ * therefore committed after run(), e.g.
+ *
+ *     TaskGraph graph;
+ *     auto uX = graph.add("Ux", [&](const TaskContext&) { dsl::solve(eqnUx, Ux, ...); });
+ *     auto uY = graph.add("Uy", [&](const TaskContext&) { dsl::solve(eqnUy, Uy, ...); });
+ *     graph.add("T", [&](const TaskContext&) { dsl::solve(eqnT, T, ...); }, {uX, uY});
+ *     graph.run();
+ *     runTime++;
+ *
+ * Tasks of one wave must not write to the same fields. Kernels which are launched on the
+ * default instance of an executor, e.g. by the NeoFOAM operators, are serialised by Kokkos;
+ * kernels launched on TaskContext::space, see parallelFor, overlap.
+ */
+class TaskGraph
+{
+public:
+
+    using TaskId = label;
+    using Task = std::function<void(const TaskContext&)>;
+
+    //- maxConcurrency limits the number of concurrent tasks, 0 uses the host concurrency
+    explicit TaskGraph(const label maxConcurrency = 0);
+
+    //- adds a task that starts after all tasks in dependencies have finished
+    TaskId add(const word& name, Task task, const std::vector<TaskId>& dependencies = {});
+
+    label size() const { return tasks_.size(); }
+
+    //- ids of the tasks grouped into waves of independent tasks
+    std::vector<std::vector<TaskId>> waves() const;
+
+    //- executes all tasks and returns after the last task has finished
+    void run() const;
+
+    void clear() { tasks_.clear(); }
+
+private:
+
+    struct Node
+    {
+        word name;
+        Task task;
+        std::vector<TaskId> dependencies;
+    };
+
+    label maxConcurrency_;
+    std::vector<Node> tasks_;
+};
+
+/* @brief launches a kernel on the execution space partition of a task */
+template<typename Kernel>
+void parallelFor(
+    const TaskContext& context,
+    std::pair<size_t, size_t> range,
+    const Kernel& kernel,
+    const std::string& name = "parallelFor"
+)
+{
+    auto [start, end] = range;
+    Kokkos::parallel_for(
+        name,
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(context.space, start, end),
+        kernel
+    );
+}
+
+} // namespace Foam
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "label.H"
+
+namespace Foam
+{
+
+/* @class WorkStealingPool
+ * @brief host thread pool with one job queue per worker
+ *
+ * Jobs submitted from a worker are pushed to its own queue, other jobs are distributed round
+ * robin. A worker takes jobs from the back of its own queue and steals from the front of the
+ * other queues once its queue is empty, so short dependent jobs stay on one thread while
+ * independent jobs spread over the pool.
+ */
+class WorkStealingPool
+{
+public:
+
+    using Job = std::function<void()>;
+
+    //- nThreads of 0 uses half the hardware threads, at least one
+    explicit WorkStealingPool(const label nThreads = 0);
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+
+    void operator=(const WorkStealingPool&) = delete;
+
+    //- finishes all submitted jobs before joining the workers
+    ~WorkStealingPool();
+
+    label nThreads() const { return workers_.size(); }
+
+    void submit(Job job);
+
+    //- blocks until all submitted jobs have finished
+    void wait();
+
+private:
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    bool tryPop(const size_t workeri, Job& job);
+
+    void work(const size_t workeri);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeUp_;
+    std::condition_variable idle_;
+    size_t nPending_ = 0; // submitted and not yet finished
+    size_t nQueued_ = 0;  // submitted and not yet reserved by a worker
+    std::atomic<size_t> next_ = 0;
+    bool stop_ = false;
+};
+
+} // namespace Foam
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "dictionary.H"
+#include "fvMesh.H"
+#include "Ostream.H"
+
+#include "NeoFOAM/core/executor/executor.hpp"
+
+namespace Foam
+{
+
+/* @class PerfCounters
+ * @brief hardware counters of all threads of the process via perf_event_open
+ *
+ * The counters are opened for the threads existing on construction, i.e. the Kokkos host
+ * threads if constructed after Kokkos::initialize. Counters that cannot be opened, e.g. due to
+ * perf_event_paranoid, in containers or on other platforms, are reported as unavailable and
+ * read as zero. If enable is false no counters are opened.
+ */
+class PerfCounters
+{
+public:
+
+    enum Event
+    {
+        cycles,
+        instructions,
+        llcMisses,
+        nEvents
+    };
+
+    using Values = std::array<uint64_t, nEvents>;
+
+    explicit PerfCounters(const bool enable = true);
+
+    PerfCounters(const PerfCounters&) = delete;
+
+    void operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters();
+
+    bool available(const Event event) const { return available_[event]; }
+
+    //- resets and enables the counters
+    void start();
+
+    //- disables the counters and returns the sum over all threads
+    Values stop();
+
+private:
+
+    // one file descriptor per thread and event, -1 if not available
+    std::vector<std::array<int, nEvents>> fds_;
+    std::array<bool, nEvents> available_ {};
+};
+
+/* @brief compulsory memory traffic and floating point operations of one kernel call
+ *
+ * the bytes assume that every array entry is transferred once per access, i.e. no cache reuse
+ * of cell values between faces
+ */
+struct KernelCost
+{
+    double bytes = 0;
+    double flops = 0;
+};
+
+//- cost models of the adapter operators for scalar fields on the given mesh
+std::map<std::string, KernelCost> operatorCosts(const fvMesh& mesh);
+
+/* @class KernelProfiler
+ * @brief measures kernels with wall time and hardware counters and derives roofline numbers
+ *
+ * With the peak bandwidth and peak flop rate of the machine, the report gives the fraction of
+ * the attainable performance min(peakFlops, intensity * peakBandwidth) of each kernel.
+ */
+class KernelProfiler
+{
+public:
+
+    struct Stats
+    {
+        KernelCost cost;
+        label calls = 0;
+        double time = 0;
+        PerfCounters::Values counters {};
+    };
+
+    KernelProfiler(
+        const double peakBandwidth = 0,
+        const double peakFlops = 0,
+        const bool hardwareCounters = true
+    );
+
+    //- runs the kernel nRepetitions times and accumulates its statistics under name
+    template<typename Kernel>
+    void measure(
+        const std::string& name,
+        const KernelCost& cost,
+        Kernel kernel,
+        const label nRepetitions = 1
+    )
+    {
+        Stats& stats = stats_[name];
+        stats.cost = cost;
+        for (label i = 0; i < nRepetitions; i++)
+        {
+            Kokkos::fence();
+            counters_.start();
+            auto start = std::chrono::high_resolution_clock::now();
+            kernel();
+            Kokkos::fence();
+            auto end = std::chrono::high_resolution_clock::now();
+            const auto counters = counters_.stop();
+
+            stats.calls++;
+            stats.time += std::chrono::duration<double>(end - start).count();
+            for (size_t event = 0; event < counters.size(); event++)
+            {
+                stats.counters[event] += counters[event];
+            }
+        }
+    }
+
+    const std::map<std::string, Stats>& stats() const { return stats_; }
+
+    const PerfCounters& counters() const { return counters_; }
+
+    void write(Ostream& os) const;
+
+private:
+
+    double peakBandwidth_;
+    double peakFlops_;
+    PerfCounters counters_;
+    std::map<std::string, Stats> stats_;
+};
+
+/* @brief profiles the interpolation, div, grad and boundary update kernels on the executor
+ * if enabled in the kernelProfiling sub dictionary
+ *
+ *     kernelProfiling
+ *     {
+ *         active          true;
+ *         repetitions     10;
+ *         peakBandwidth   200e9;  // bytes/s, optional
+ *         peakFlops       2e12;   // flop/s, optional
+ *         hardwareCounters true;  // perf_event_open counters, optional
+ *     }
+ *
+ * on the GPUExecutor the hardware counters only cover the host threads
+ */
+void profileKernels(const NeoFOAM::Executor& exec, const fvMesh& mesh, const dictionary& dict);
+
+} // namespace Foam
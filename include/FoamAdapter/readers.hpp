@@ -6,75 +6,151 @@
 #include "NeoFOAM/core/dictionary.hpp"
 #include "NeoFOAM/core/executor/executor.hpp"
 #include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
 #include "NeoFOAM/core/database/fieldCollection.hpp"
 
 #include "FoamAdapter/conversion/convert.hpp"
 #include "FoamAdapter/conversion/type_conversion.hpp"
+#include "FoamAdapter/memory/hugePages.hpp"
 
 namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
 
 namespace Foam
 {
 namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+/* @brief copies an OpenFOAM field to the executor
+ *
+ * On host executors the field is allocated without initialisation, advised according to the
+ * HugePagePolicy and filled by a kernel with the same range partitioning as the compute
+ * kernels. Thus, first touch places each page on the NUMA domain of the thread which later
+ * works on it. The placement of the threads is controlled by OMP_PROC_BIND and OMP_PLACES.
+ */
 template<typename FoamType>
 auto fromFoamField(const NeoFOAM::Executor& exec, const FoamType& field)
 {
     using type_container_t = typename type_map<FoamType>::container_type;
     using mapped_t = typename type_map<FoamType>::mapped_type;
-    type_container_t nfField(
-        exec,
-        reinterpret_cast<const mapped_t*>(field.cdata()),
-        static_cast<size_t>(field.size())
-    );
+    const mapped_t* src = reinterpret_cast<const mapped_t*>(field.cdata());
+    const size_t size = static_cast<size_t>(field.size());
 
+    if (!std::holds_alternative<NeoFOAM::GPUExecutor>(exec))
+    {
+        type_container_t nfField(exec, size);
+        detail::adviseHugePages(nfField.data(), size * sizeof(mapped_t));
+        auto dst = nfField.span();
+        NeoFOAM::parallelFor(
+            exec, {0, size}, KOKKOS_LAMBDA(const size_t i) { dst[i] = src[i]; }
+        );
+        return nfField;
+    }
+
+    type_container_t nfField(exec, src, size);
     return nfField;
 };
 
-template<typename FoamType>
-auto readVolBoundaryConditions(const NeoFOAM::UnstructuredMesh& nfMesh, const FoamType& ofVolField)
+/* @brief reads a uniform entry of an OpenFOAM patch dictionary, e.g. value uniform (1 0 0)
+ *
+ * the NeoFOAM boundary conditions hold a single value per patch, so non-uniform entries are
+ * rejected. OpenFOAM writes the entries of zero sized patches as empty non-uniform lists, which
+ * are read as zero
+ */
+template<typename ValueType>
+ValueType readUniformEntry(const dictionary& patchDict, const word& keyword)
 {
-    using type_container_t = typename type_map<FoamType>::container_type;
-    using type_primitive_t = typename type_map<FoamType>::mapped_type;
+    using FoamValueType =
+        std::conditional_t<std::is_same_v<ValueType, NeoFOAM::Vector>, vector, ValueType>;
 
-    // get boundary as dictionary
-    OStringStream os;
-    ofVolField.boundaryField().writeEntries(os);
-    IStringStream is(os.str());
-    dictionary bDict(is);
+    ITstream& is = patchDict.lookup(keyword);
+    const word kind(is);
+    if (kind == "nonuniform")
+    {
+        List<FoamValueType> values;
+        is >> values;
+        if (values.empty())
+        {
+            return ValueType {};
+        }
+    }
+    if (kind != "uniform")
+    {
+        FatalIOErrorInFunction(patchDict)
+            << keyword << " has to be uniform, non-uniform patch values are not supported"
+            << exit(FatalIOError);
+    }
+    FoamValueType value;
+    is >> value;
+    if constexpr (std::is_same_v<ValueType, NeoFOAM::Vector>)
+    {
+        return convert(value);
+    }
+    else
+    {
+        return value;
+    }
+}
 
-    std::map<std::string, std::function<void(NeoFOAM::Dictionary&)>> patchInserter {
-        {"fixedGradient", [](auto& dict) { dict.insert("type", std::string("fixedGradient")); }},
+/* @brief creates the NeoFOAM boundary conditions from an OpenFOAM boundaryField dictionary
+ *
+ * the patch entries need to be in the order of the mesh patches
+ */
+template<typename ValueType>
+std::vector<fvcc::VolumeBoundary<ValueType>>
+volBoundaryConditions(const NeoFOAM::UnstructuredMesh& nfMesh, const dictionary& bDict)
+{
+    using PatchInserter = std::function<void(NeoFOAM::Dictionary&, const dictionary&)>;
+    std::map<std::string, PatchInserter> patchInserter {
+        {"fixedGradient",
+         [](auto& dict, const auto& patchDict)
+         {
+             dict.insert("type", std::string("fixedGradient"));
+             dict.insert("fixedGradient", readUniformEntry<ValueType>(patchDict, "gradient"));
+         }},
         {"zeroGradient",
-         [&](auto& dict)
+         [&](auto& dict, const auto&)
          {
              dict.insert("type", std::string("fixedGradient"));
-             dict.insert("fixedGradient", type_primitive_t {});
+             dict.insert("fixedGradient", ValueType {});
          }},
         {"fixedValue",
-         [](auto& dict)
+         [](auto& dict, const auto& patchDict)
          {
              dict.insert("type", std::string("fixedValue"));
-             dict.insert("fixedValue", type_primitive_t {});
+             dict.insert("fixedValue", readUniformEntry<ValueType>(patchDict, "value"));
          }},
-        {"calculated", [](auto& dict) { dict.insert("type", std::string("calculated")); }},
+        {"calculated",
+         [](auto& dict, const auto&) { dict.insert("type", std::string("calculated")); }},
         {"extrapolatedCalculated",
-         [](auto& dict) { dict.insert("type", std::string("calculated")); }},
-        {"empty", [](auto& dict) { dict.insert("type", std::string("empty")); }}
+         [](auto& dict, const auto&) { dict.insert("type", std::string("calculated")); }},
+        {"empty", [](auto& dict, const auto&) { dict.insert("type", std::string("empty")); }}
     };
 
     int patchi = 0;
-    std::vector<fvcc::VolumeBoundary<type_primitive_t>> bcs;
+    std::vector<fvcc::VolumeBoundary<ValueType>> bcs;
     for (const auto& bName : bDict.toc())
     {
         dictionary patchDict = bDict.subDict(bName);
         NeoFOAM::Dictionary neoPatchDict;
-        patchInserter[patchDict.get<word>("type")](neoPatchDict);
+        patchInserter[patchDict.get<word>("type")](neoPatchDict, patchDict);
         bcs.emplace_back(nfMesh, neoPatchDict, patchi);
         patchi++;
     }
     return bcs;
 }
 
+template<typename FoamType>
+auto readVolBoundaryConditions(const NeoFOAM::UnstructuredMesh& nfMesh, const FoamType& ofVolField)
+{
+    using type_primitive_t = typename type_map<FoamType>::mapped_type;
+
+    // get boundary as dictionary
+    OStringStream os;
+    ofVolField.boundaryField().writeEntries(os);
+    IStringStream is(os.str());
+    dictionary bDict(is);
+
+    return volBoundaryConditions<type_primitive_t>(nfMesh, bDict);
+}
+
 template<typename FoamType>
 auto constructFrom(
     const NeoFOAM::Executor exec,
@@ -111,29 +187,38 @@ auto readSurfaceBoundaryConditions(
     dictionary bDict(is);
     int patchi = 0;
 
-    std::map<std::string, std::function<void(NeoFOAM::Dictionary&)>> patchInserter {
-        {"fixedGradient", [](auto& dict) { dict.insert("type", std::string("fixedGradient")); }},
+    using PatchInserter = std::function<void(NeoFOAM::Dictionary&, const dictionary&)>;
+    std::map<std::string, PatchInserter> patchInserter {
+        {"fixedGradient",
+         [](auto& dict, const auto& patchDict)
+         {
+             dict.insert("type", std::string("fixedGradient"));
+             dict.insert(
+                 "fixedGradient", readUniformEntry<type_primitive_t>(patchDict, "gradient")
+             );
+         }},
         {"zeroGradient",
-         [&](auto& dict)
+         [&](auto& dict, const auto&)
          {
              dict.insert("type", std::string("fixedGradient"));
              dict.insert("fixedGradient", type_primitive_t {});
          }},
         {"fixedValue",
-         [](auto& dict)
+         [](auto& dict, const auto& patchDict)
          {
              dict.insert("type", std::string("fixedValue"));
-             dict.insert("fixedValue", type_primitive_t {});
+             dict.insert("fixedValue", readUniformEntry<type_primitive_t>(patchDict, "value"));
          }},
-        {"calculated", [](auto& dict) { dict.insert("type", std::string("calculated")); }},
-        {"empty", [](auto& dict) { dict.insert("type", std::string("empty")); }}
+        {"calculated",
+         [](auto& dict, const auto&) { dict.insert("type", std::string("calculated")); }},
+        {"empty", [](auto& dict, const auto&) { dict.insert("type", std::string("empty")); }}
     };
 
     for (const auto& bName : bDict.toc())
     {
         dictionary patchDict = bDict.subDict(bName);
         NeoFOAM::Dictionary neoPatchDict;
-        patchInserter[patchDict.get<word>("type")](neoPatchDict);
+        patchInserter[patchDict.get<word>("type")](neoPatchDict, patchDict);
         bcs.push_back(fvcc::SurfaceBoundary<type_primitive_t>(uMesh, neoPatchDict, patchi));
         patchi++;
     }
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <string>
+
+#include "dictionary.H"
+#include "fileName.H"
+#include "polyBoundaryMesh.H"
+
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/core/executor/executor.hpp"
+
+#include "FoamAdapter/meshAdapter.hpp"
+#include "FoamAdapter/readers.hpp"
+
+namespace Foam
+{
+
+/* @class FieldFile
+ * @brief reads OpenFOAM field files directly into NeoFOAM fields
+ *
+ * The file is memory mapped and only the header and the boundaryField are parsed by
+ * OpenFOAM. A nonuniform internalField is parsed in parallel chunks with std::from_chars in
+ * ascii format or copied from the mapped file in binary format, i.e. no GeometricField is
+ * created. Compressed files are not supported.
+ */
+class FieldFile
+{
+public:
+
+    explicit FieldFile(const fileName& file);
+
+    FieldFile(const FieldFile&) = delete;
+
+    void operator=(const FieldFile&) = delete;
+
+    ~FieldFile();
+
+    const dictionary& header() const { return header_; }
+
+    bool binary() const { return binary_; }
+
+    //- the boundaryField entries in the order of the patches of bMesh
+    dictionary boundaryField(const polyBoundaryMesh& bMesh) const;
+
+    //- reads the internalField, size is the expected number of entries
+    template<typename ValueType>
+    NeoFOAM::Field<ValueType> internalField(const NeoFOAM::Executor& exec, const label size) const;
+
+private:
+
+    fileName file_;
+    int fd_ = -1;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+
+    dictionary header_;
+    bool binary_ = false;
+
+    //- number of scalars per entry of the internalField
+    label nComponents_ = 1;
+
+    //- value of a uniform internalField or of a compact list, e.g. 100{0}
+    bool uniform_ = false;
+    std::string uniformValue_;
+
+    //- number of entries and raw data of a nonuniform internalField
+    label nEntries_ = -1;
+    const char* payloadBegin_ = nullptr;
+    const char* payloadEnd_ = nullptr;
+
+    //- entries before the internalField and after it, e.g. dimensions and boundaryField
+    std::string preamble_;
+    std::string tail_;
+};
+
+/* @brief reads the volume field name of the current time without a GeometricField */
+template<typename FoamType>
+typename type_map<FoamType>::container_type
+readVolField(const NeoFOAM::Executor& exec, const MeshAdapter& mesh, const word& name)
+{
+    using type_container_t = typename type_map<FoamType>::container_type;
+    using type_primitive_t = typename type_map<FoamType>::mapped_type;
+
+    FieldFile file(mesh.time().timePath() / mesh.dbDir() / name);
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh.nfMesh();
+
+    type_container_t out(
+        exec,
+        name,
+        nfMesh,
+        volBoundaryConditions<type_primitive_t>(nfMesh, file.boundaryField(mesh.boundaryMesh()))
+    );
+    out.internalField() = file.internalField<type_primitive_t>(exec, mesh.nCells());
+    out.correctBoundaryConditions();
+
+    return out;
+}
+
+} // namespace Foam
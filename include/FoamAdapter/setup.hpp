@@ -10,6 +10,7 @@
 #include "FoamAdapter/meshAdapter.hpp"
 
 #include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/surfaceField.hpp"
 
 #include "fvCFD.H" // include after NeoFOAM to avoid ambiguous sqrt error
 
@@ -21,13 +22,33 @@ std::tuple<bool, scalar, scalar> timeControls(const Time& runTime);
 
 scalar calculateCoNum(const surfaceScalarField& phi);
 
+//- the Courant number of a NeoFOAM face flux computed on the executor, see calculateCoNum
+scalar calculateCoNum(
+    const MeshAdapter& mesh,
+    const NeoFOAM::finiteVolume::cellCentred::SurfaceField<NeoFOAM::scalar>& phi,
+    scalar deltaT
+);
+
 void setDeltaT(Time& runTime, scalar maxCo, scalar CoNum, scalar maxDeltaT);
 
 std::unique_ptr<MeshAdapter> createMesh(const NeoFOAM::Executor& exec, const Time& runTime);
 
+//- creates the mesh of the given region, see RegionMeshes for all regions of a case
+std::unique_ptr<MeshAdapter>
+createMesh(const NeoFOAM::Executor& exec, const Time& runTime, const word& regionName);
+
 std::unique_ptr<fvMesh> createMesh(const Time& runTime);
 
+NeoFOAM::Executor createExecutor(const word& execName);
+
 NeoFOAM::Executor createExecutor(const dictionary& dict);
 
+/* @brief creates the executor given by the executor entry of the controlDict
+ *
+ * in addition to Serial, CPU and GPU this supports executor auto, which selects the fastest
+ * executor for the case mesh, see autoSelectExecutor
+ */
+NeoFOAM::Executor createExecutor(const Time& runTime);
+
 
 } // namespace Foam
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include "fvMesh.H"
+#include "Time.H"
+
+#include "NeoFOAM/core/executor/executor.hpp"
+
+namespace Foam
+{
+
+/* @brief timings of the core adapter operators on one executor */
+struct ExecutorCalibration
+{
+    //- executor name as used in the controlDict, set by the caller
+    word executor;
+    scalar interpolation = 0;
+    scalar div = 0;
+    scalar grad = 0;
+    scalar bcUpdate = 0;
+
+    scalar total() const { return interpolation + div + grad + bcUpdate; }
+};
+
+class KernelProfiler;
+
+/* @brief times short runs of linear interpolation, Gauss divergence, Gauss gradient and
+ * the boundary condition update on the given executor
+ *
+ * returns the median run time of each operator in seconds
+ * @param profiler if given, additionally measures each operator with hardware counters
+ */
+ExecutorCalibration calibrateExecutor(
+    const NeoFOAM::Executor& exec,
+    const fvMesh& mesh,
+    const label nRepetitions,
+    KernelProfiler* profiler = nullptr
+);
+
+//- key of the cached executor decisions, i.e. host name, host threads, ranks and mesh hash
+word executorCacheKey(const fvMesh& mesh);
+
+/* @brief selects the fastest executor for the case mesh
+ *
+ * The decision is cached per mesh hash and machine, i.e. host name and number of host
+ * threads, see executorCacheKey. Settings are read from the optional executorTuning sub
+ * dictionary of the controlDict:
+ *
+ *     executorTuning
+ *     {
+ *         repetitions 5;     // timed runs per operator
+ *         cache       true;  // reuse and store decisions
+ *         cacheFile   "$HOME/.cache/FoamAdapter/executorCache"; // optional
+ *     }
+ *
+ * The NeoFOAM operators are launched with flat range policies, so the executor is the only
+ * tunable launch parameter.
+ */
+NeoFOAM::Executor autoSelectExecutor(const Time& runTime);
+
+//- selects the fastest executor with the settings of the executorTuning dictionary
+NeoFOAM::Executor autoSelectExecutor(const Time& runTime, const dictionary& tuningDict);
+
+} // namespace Foam
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "dictionary.H"
+#include "fvMesh.H"
+
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/mesh/unstructured.hpp"
+
+#include "FoamAdapter/memory/hugePages.hpp"
+
+namespace Foam
+{
+
+/* @brief sets the chunk size of the mesh conversion in bytes, 0 converts whole arrays */
+void setMeshConversionChunkSize(const size_t bytes);
+
+size_t meshConversionChunkSize();
+
+/* @brief releases the OpenFOAM copies of the mesh data held by NeoFOAM after the conversion
+ *
+ * The MeshAdapter then clears the geometry and the derived addressing of the fvMesh, e.g. the
+ * cell centres, face areas and the cells built by the constructor from cells. The points, faces
+ * and owner/neighbour are the primary data of the polyMesh and stay duplicated. OpenFOAM
+ * recomputes the cleared arrays on demand, so the memory is only saved while the solver uses
+ * the NeoFOAM mesh alone, e.g. not with fvc operators or mesh.C().
+ */
+void setReleaseFoamStorage(const bool release);
+
+bool releaseFoamStorage();
+
+/* @brief sets the chunk size and release from the meshConversion sub dictionary
+ *
+ *     meshConversion
+ *     {
+ *         chunkSize           67108864;  // bytes of host staging memory, 0 converts whole arrays
+ *         releaseFoamStorage  false;
+ *     }
+ */
+void readMeshConversion(const dictionary& controlDict);
+
+/* @brief converts the mesh array by array, each in chunks of at most chunkBytes
+ *
+ * The derived arrays, i.e. the face area magnitudes and the flattened boundary fields, are
+ * computed per entry instead of as temporary fields. On host executors the entries are written
+ * to the NeoFOAM arrays directly, on the GPU through a host staging buffer of chunkBytes that is
+ * uploaded and reused for the next chunk. The peak host memory of the conversion is thus the
+ * OpenFOAM mesh plus one chunk.
+ */
+NeoFOAM::UnstructuredMesh
+readOpenFOAMMeshChunked(const NeoFOAM::Executor& exec, const fvMesh& mesh, const size_t chunkBytes);
+
+namespace detail
+{
+
+/* @brief creates a field of size entries on the executor from value(i) in chunks
+ *
+ * value is called concurrently on the host
+ */
+template<typename ValueType, typename ValueFunction>
+NeoFOAM::Field<ValueType> uploadChunked(
+    const NeoFOAM::Executor& exec,
+    const size_t size,
+    const size_t chunkBytes,
+    const ValueFunction& value
+)
+{
+    using HostSpace = Kokkos::DefaultHostExecutionSpace;
+
+    NeoFOAM::Field<ValueType> field(exec, size);
+    if (!std::holds_alternative<NeoFOAM::GPUExecutor>(exec))
+    {
+        // value reads OpenFOAM data and must only be instantiated for the host space
+        adviseHugePages(field.data(), size * sizeof(ValueType));
+        ValueType* out = field.data();
+        Kokkos::parallel_for(
+            "uploadChunked",
+            Kokkos::RangePolicy<HostSpace>(0, size),
+            [&](const size_t i) { out[i] = value(i); }
+        );
+        HostSpace().fence();
+        return field;
+    }
+
+    using DeviceMemory = Kokkos::DefaultExecutionSpace::memory_space;
+    using Unmanaged = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+
+    const size_t chunkSize = std::max<size_t>(1, std::min(size, chunkBytes / sizeof(ValueType)));
+    std::vector<ValueType> staging(chunkSize);
+    for (size_t start = 0; start < size; start += chunkSize)
+    {
+        const size_t n = std::min(chunkSize, size - start);
+        ValueType* buffer = staging.data();
+        Kokkos::parallel_for(
+            "uploadChunked::stage",
+            Kokkos::RangePolicy<HostSpace>(0, n),
+            [&](const size_t i) { buffer[i] = value(start + i); }
+        );
+        Kokkos::View<ValueType*, Kokkos::HostSpace, Unmanaged> src(buffer, n);
+        Kokkos::View<ValueType*, DeviceMemory, Unmanaged> dst(field.data() + start, n);
+        Kokkos::deep_copy(dst, src);
+    }
+    return field;
+}
+
+} // namespace detail
+
+} // namespace Foam
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "HashTable.H"
+#include "PtrList.H"
+#include "Time.H"
+
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/core/primitives/label.hpp"
+
+#include "FoamAdapter/meshAdapter.hpp"
+
+namespace Foam
+{
+
+/* @brief reads the region names from constant/regionProperties
+ *
+ * the regions entry groups the regions by type, e.g. regions (fluid (water) solid (heater));
+ * returns the region names and their type in the order of the sorted types. If the case has
+ * no regionProperties the default region is returned with an empty type.
+ */
+std::pair<wordList, HashTable<word>> readRegionProperties(const Time& runTime);
+
+/* @brief coupling interface of a mapped patch to the patch of another region
+ *
+ * the maps are device resident, i.e. they can be used in kernels to gather values of the
+ * neighbour region for each face of the patch
+ */
+struct RegionInterface
+{
+    word region;
+    word patch;
+    label patchi;
+
+    word nbrRegion;
+    word nbrPatch;
+    label nbrPatchi;
+
+    //- offset of the patch in the flat boundary arrays of region
+    NeoFOAM::label offset;
+
+    //- for each patch face the index of the coupled face in the flat boundary of nbrRegion
+    NeoFOAM::Field<NeoFOAM::label> nbrBoundaryFaces;
+
+    //- for each patch face the cell of nbrRegion adjacent to the coupled face
+    NeoFOAM::Field<NeoFOAM::label> nbrFaceCells;
+
+    label size() const { return nbrBoundaryFaces.size(); }
+};
+
+/* @class RegionMeshes
+ * @brief one MeshAdapter per region of a multi-region case on a shared executor
+ *
+ * The regions are read from constant/regionProperties. The mapped patches coupling the
+ * regions, e.g. mappedWall patches of conjugate heat transfer cases, are converted into
+ * RegionInterfaces. Only nearestPatchFace mappings between faces on the same processor are
+ * supported since the interfaces are plain index maps.
+ *
+ * The regions only share the executor and the Time, i.e. the solves of different regions are
+ * independent and can be advanced concurrently between interface updates.
+ */
+class RegionMeshes
+{
+public:
+
+    RegionMeshes(const NeoFOAM::Executor& exec, const Time& runTime);
+
+    RegionMeshes(const RegionMeshes&) = delete;
+
+    void operator=(const RegionMeshes&) = delete;
+
+    const NeoFOAM::Executor& exec() const { return exec_; }
+
+    label size() const { return names_.size(); }
+
+    const wordList& names() const { return names_; }
+
+    //- region names of the given type, e.g. fluid or solid
+    wordList names(const word& regionType) const;
+
+    //- type of the region as given in regionProperties
+    const word& regionType(const word& regionName) const { return types_[regionName]; }
+
+    MeshAdapter& operator[](const label regioni) { return meshes_[regioni]; }
+
+    const MeshAdapter& operator[](const label regioni) const { return meshes_[regioni]; }
+
+    MeshAdapter& mesh(const word& regionName) { return meshes_[names_.find(regionName)]; }
+
+    const MeshAdapter& mesh(const word& regionName) const
+    {
+        return meshes_[names_.find(regionName)];
+    }
+
+    //- all coupling interfaces
+    const std::vector<RegionInterface>& interfaces() const { return interfaces_; }
+
+    //- coupling interfaces of the patches of the given region
+    std::vector<const RegionInterface*> interfaces(const word& regionName) const;
+
+private:
+
+    NeoFOAM::Executor exec_;
+    wordList names_;
+    HashTable<word> types_;
+    PtrList<MeshAdapter> meshes_;
+    std::vector<RegionInterface> interfaces_;
+};
+
+/* @brief copies the values of the neighbour region onto the faces of an interface
+ *
+ * @param nbrBoundaryValues flat boundary values of the neighbour region
+ * @param boundaryValues flat boundary values of the region, only the interface faces are set
+ */
+template<typename ValueType>
+void mapInterface(
+    const NeoFOAM::Executor& exec,
+    const RegionInterface& interface,
+    std::span<const ValueType> nbrBoundaryValues,
+    std::span<ValueType> boundaryValues
+)
+{
+    const NeoFOAM::label offset = interface.offset;
+    const auto nbrFaces = interface.nbrBoundaryFaces.span();
+    NeoFOAM::parallelFor(
+        exec,
+        {0, nbrFaces.size()},
+        KOKKOS_LAMBDA(const size_t facei) {
+            boundaryValues[offset + facei] = nbrBoundaryValues[nbrFaces[facei]];
+        }
+    );
+}
+
+} // namespace Foam
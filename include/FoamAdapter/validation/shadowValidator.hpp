@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+
+#include "volFields.H"
+
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/core/executor/executor.hpp"
+
+#include "FoamAdapter/writers.hpp"
+#include "FoamAdapter/comparison/errorNorms.hpp"
+
+namespace Foam
+{
+
+/* @class ShadowValidator
+ * @brief runs an OpenFOAM reference step side by side with the NeoFOAM solver
+ *
+ * Every interval time steps the state of the NeoFOAM field is copied into a private OpenFOAM
+ * field which is advanced by a user supplied reference step on a separate host thread while
+ * the NeoFOAM step continues. Once the reference has finished, the NeoFOAM result of the
+ * same step is compared on the executor and the deviation is logged. The main loop only
+ * polls the reference, i.e. it never waits for OpenFOAM.
+ *
+ * Controlled by the shadowValidation sub dictionary:
+ *
+ *     shadowValidation
+ *     {
+ *         active      true;
+ *         interval    10;     // validate every 10th time step
+ *         tolerance   1e-10;  // maximum accepted Linf deviation
+ *     }
+ *
+ * The reference step runs concurrently to the main loop, which advances the Time and
+ * evaluates the mesh. It is therefore given plain copies of the internal values and of the
+ * flattened boundary values at the start of the step and must only use these and data it
+ * copied into plain arrays before the launch, e.g. the flux and the cell volumes. It must not
+ * use the Time, the mesh, registered fields or fvc operators. The boundary conditions of the
+ * result are evaluated by the calling thread when the result is compared. In parallel runs
+ * the reference step is executed synchronously so that all processors compare together.
+ */
+template<typename FoamType>
+class ShadowValidator
+{
+public:
+
+    using container_type = typename type_map<FoamType>::container_type;
+    using value_type = typename type_map<FoamType>::mapped_type;
+    using foam_value_type = typename FoamType::value_type;
+    //- advances the internal values given the boundary values in the NeoFOAM patch order
+    using ReferenceStep =
+        std::function<void(Field<foam_value_type>&, const Field<foam_value_type>&)>;
+
+    ShadowValidator(const NeoFOAM::Executor& exec, const FoamType& field, const dictionary& dict)
+        : exec_(exec), field_(field)
+    {
+        const dictionary* shadowDict = dict.findDict("shadowValidation");
+        if (shadowDict)
+        {
+            active_ = shadowDict->getOrDefault<bool>("active", true);
+            interval_ = max(shadowDict->getOrDefault<label>("interval", 1), 1);
+            tolerance_ = shadowDict->getOrDefault<scalar>("tolerance", SMALL);
+        }
+        if (active_)
+        {
+            Info << "Shadow validation of " << field.name() << " every " << interval_
+                 << " time steps with tolerance " << tolerance_ << endl;
+        }
+    }
+
+    ShadowValidator(const ShadowValidator&) = delete;
+
+    void operator=(const ShadowValidator&) = delete;
+
+    ~ShadowValidator() { finish(); }
+
+    bool active() const { return active_; }
+
+    //- true if a validation should be started at the given time index
+    bool due(const label timeIndex) const { return active_ && timeIndex % interval_ == 0; }
+
+    //- number of validations that exceeded the tolerance
+    label nFailed() const { return nFailed_; }
+
+    //- report of the last finished validation
+    const std::optional<ComparisonReport>& lastReport() const { return lastReport_; }
+
+    /* @brief starts the reference step from the current NeoFOAM state
+     *
+     * needs to be called before the NeoFOAM field is advanced in time. If the previous
+     * reference step is still running the validation is skipped.
+     */
+    void launch(const label timeIndex, const container_type& nfField, ReferenceStep step)
+    {
+        if (!due(timeIndex))
+        {
+            return;
+        }
+        if (reference_.valid())
+        {
+            Info << "Shadow validation of " << field_.name() << " at time index " << timeIndex
+                 << " skipped, reference of time index " << pendingIndex_ << " still running"
+                 << endl;
+            return;
+        }
+
+        if (!shadow_)
+        {
+            shadow_ = std::make_unique<FoamType>(
+                IOobject(
+                    field_.name() + "_shadow",
+                    field_.instance(),
+                    field_.db(),
+                    IOobject::NO_READ,
+                    IOobject::NO_WRITE,
+                    false
+                ),
+                field_
+            );
+        }
+        detail::copy_impl(shadow_->primitiveFieldRef(), nfField.internalField());
+        shadow_->correctBoundaryConditions();
+        values_ = shadow_->primitiveField();
+        boundaryValues_ = detail::flatBoundaryField(*shadow_);
+
+        pendingIndex_ = timeIndex;
+        nfResult_.reset();
+        reference_ = std::async(
+            Pstream::parRun() ? std::launch::deferred : std::launch::async,
+            [step, &values = values_, &boundaryValues = boundaryValues_]()
+            { step(values, boundaryValues); }
+        );
+    }
+
+    /* @brief records the NeoFOAM result of the step started by launch
+     *
+     * the internal and boundary values are copied on the executor so the NeoFOAM field can
+     * be advanced further while the reference is still running
+     */
+    void record(const container_type& nfField)
+    {
+        if (!reference_.valid() || nfResult_)
+        {
+            return;
+        }
+        nfResult_.emplace(nfField.internalField(), nfField.boundaryField().value());
+        if (Pstream::parRun())
+        {
+            reference_.wait();
+        }
+    }
+
+    //- compares and logs the deviation if the reference has finished, does not block
+    void poll()
+    {
+        if (reference_.valid() && nfResult_
+            && reference_.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            compare();
+        }
+    }
+
+    //- waits for an outstanding reference, e.g. before writing or at the end of the run
+    void finish()
+    {
+        if (reference_.valid())
+        {
+            reference_.wait();
+            if (nfResult_)
+            {
+                compare();
+            }
+            else
+            {
+                reference_.get();
+            }
+        }
+    }
+
+private:
+
+    void compare()
+    {
+        reference_.get();
+        shadow_->primitiveFieldRef() = values_;
+        shadow_->correctBoundaryConditions();
+        FieldComparator<FoamType> comparator(exec_, *shadow_);
+        const auto& [internal, boundary] = *nfResult_;
+        ComparisonReport report = comparator.compare(internal.span(), boundary.span());
+
+        Info << "Shadow validation of " << field_.name() << " at time index " << pendingIndex_
+             << ": Linf " << report.linf() << " L2 " << report.internal.l2 << " maxRel "
+             << report.internal.maxRel << endl;
+        if (!report.within(tolerance_))
+        {
+            nFailed_++;
+            WarningInFunction << "deviation exceeds tolerance " << tolerance_ << nl << report
+                              << endl;
+        }
+        lastReport_ = report;
+        nfResult_.reset();
+    }
+
+    NeoFOAM::Executor exec_;
+    const FoamType& field_;
+
+    bool active_ = false;
+    label interval_ = 1;
+    scalar tolerance_ = SMALL;
+
+    std::unique_ptr<FoamType> shadow_;
+    Field<foam_value_type> values_;
+    Field<foam_value_type> boundaryValues_;
+    std::future<void> reference_;
+    label pendingIndex_ = -1;
+    std::optional<std::pair<NeoFOAM::Field<value_type>, NeoFOAM::Field<value_type>>> nfResult_;
+
+    label nFailed_ = 0;
+    std::optional<ComparisonReport> lastReport_;
+};
+
+} // namespace Foam
@@ -4,6 +4,7 @@
 
 #include "fvMesh.H"
 #include "volFields.H"
+#include "pointFields.H"
 
 #include "NeoFOAM/fields/field.hpp"
 #include "NeoFOAM/core/error.hpp"
@@ -28,6 +29,19 @@ void copy_impl(DestField& dest, const SrcField src)
 }
 }
 
+/* @brief copies a NeoFOAM point field, e.g. from CellToPointInterpolation, to the point values
+ * of an OpenFOAM point field and evaluates its patches
+ */
+template<typename Type, typename ValueType>
+void copyToFoam(
+    const NeoFOAM::Field<ValueType>& nf,
+    GeometricField<Type, pointPatchField, pointMesh>& pf
+)
+{
+    detail::copy_impl(pf.primitiveFieldRef(), nf);
+    pf.correctBoundaryConditions();
+}
+
 void write(NeoFOAM::scalarField& sf, const Foam::fvMesh& mesh, const std::string fieldName)
 {
     Foam::volScalarField* field = mesh.getObjectPtr<Foam::volScalarField>(fieldName);
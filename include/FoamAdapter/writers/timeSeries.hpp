@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+/* This file implements an append-only binary container for the time series of a field. A file
+ * consists of
+ *
+ *     TimeSeriesHeader
+ *     TimeSeriesRecordHeader, record 0, TimeSeriesRecordHeader, record 1, ...
+ *     TimeSeriesIndexEntry[nRecords]
+ *     TimeSeriesFooter
+ *
+ * The records hold the raw or zlib compressed field values. New records overwrite the index,
+ * which is written again behind them, so all time steps of a field end up in a single file per
+ * processor. If a flush is interrupted before the new footer is written, the writer rebuilds
+ * the index from the checksummed record headers when it continues the file.
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "dictionary.H"
+#include "fileName.H"
+#include "fvMesh.H"
+
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+#include "FoamAdapter/parallel/workStealingPool.hpp"
+
+namespace Foam
+{
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+struct TimeSeriesHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t nComponents;
+    uint64_t nValues;
+    uint64_t meshHash;
+    char name[64];
+};
+
+struct TimeSeriesRecordHeader
+{
+    double time;
+    uint64_t bytes;
+    uint32_t compressed;
+    uint32_t checksum; // crc32 of the record bytes
+};
+
+struct TimeSeriesIndexEntry
+{
+    double time;
+    uint64_t offset;
+    uint64_t bytes;
+    uint32_t compressed;
+    uint32_t padding;
+};
+
+struct TimeSeriesFooter
+{
+    uint64_t indexOffset;
+    uint64_t nRecords;
+    char magic[8];
+};
+
+/* @class TimeSeriesWriter
+ * @brief appends the values of a field at each time to a time series file
+ *
+ * An existing file of the same field and mesh is continued, records at or after the first new
+ * time are dropped, e.g. on a restart. With a pool the values are compressed and written by
+ * background jobs, the records stay in order as each job writes all records appended before it.
+ */
+class TimeSeriesWriter
+{
+public:
+
+    //- meshHash identifies the mesh of the values, e.g. computeMeshHash
+    TimeSeriesWriter(
+        const fileName& file,
+        const word& name,
+        const label nComponents,
+        const label nValues,
+        const uint64_t meshHash,
+        const bool compress = false,
+        WorkStealingPool* pool = nullptr
+    );
+
+    TimeSeriesWriter(const TimeSeriesWriter&) = delete;
+
+    void operator=(const TimeSeriesWriter&) = delete;
+
+    //- writes the remaining records
+    ~TimeSeriesWriter();
+
+    //- copies the values to the host and appends them at the given time
+    template<typename ValueType>
+    void append(const scalar time, const NeoFOAM::Field<ValueType>& values);
+
+    void flush();
+
+private:
+
+    struct Record
+    {
+        double time;
+        std::vector<char> data;
+    };
+
+    struct State
+    {
+        std::mutex recordsMutex; // guards records
+        std::mutex writeMutex;   // keeps the records of concurrent flushes in order
+        int fd = -1;
+        bool compress = false;
+        std::vector<Record> records;
+        std::vector<TimeSeriesIndexEntry> index;
+        uint64_t dataEnd = 0;
+
+        ~State();
+
+        void flush();
+    };
+
+    void appendRecord(const scalar time, std::vector<char> data);
+
+    fileName file_;
+    uint64_t recordBytes_;
+    std::shared_ptr<State> state_;
+    WorkStealingPool* pool_;
+};
+
+/* @class TimeSeriesReader
+ * @brief memory mapped random access to the records of a time series file */
+class TimeSeriesReader
+{
+public:
+
+    explicit TimeSeriesReader(const fileName& file);
+
+    TimeSeriesReader(const TimeSeriesReader&) = delete;
+
+    void operator=(const TimeSeriesReader&) = delete;
+
+    ~TimeSeriesReader();
+
+    const TimeSeriesHeader& header() const { return *header_; }
+
+    label nRecords() const { return index_.size(); }
+
+    scalar time(const label recordi) const { return index_[recordi].time; }
+
+    bool compressed(const label recordi) const { return index_[recordi].compressed; }
+
+    //- the record closest to the time
+    label findRecord(const scalar time) const;
+
+    //- the values of the record, uncompressed records are not copied
+    template<typename ValueType>
+    std::span<const ValueType> values(const label recordi, std::vector<ValueType>& buffer) const;
+
+    template<typename ValueType>
+    NeoFOAM::Field<ValueType> read(const NeoFOAM::Executor& exec, const label recordi) const;
+
+private:
+
+    fileName file_;
+    int fd_ = -1;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    const TimeSeriesHeader* header_ = nullptr;
+    std::span<const TimeSeriesIndexEntry> index_;
+};
+
+/* @class TimeSeriesOutput
+ * @brief the time series writers of the timeSeries sub dictionary
+ *
+ *     timeSeries
+ *     {
+ *         fields          (nfT);
+ *         interval        1;      // time steps between records
+ *         compression     false;
+ *     }
+ *
+ * the records are written to timeSeries/<field>.nfts in the case or processor directory
+ */
+class TimeSeriesOutput
+{
+public:
+
+    TimeSeriesOutput(const fvMesh& mesh, const dictionary& dict, WorkStealingPool* pool = nullptr);
+
+    bool empty() const { return fields_.empty(); }
+
+    //- appends the internal field if it is listed and due
+    template<typename ValueType>
+    void write(const fvcc::VolumeField<ValueType>& field);
+
+private:
+
+    const fvMesh& mesh_;
+    WorkStealingPool* pool_;
+    wordList fields_;
+    label interval_;
+    bool compress_;
+    uint64_t meshHash_;
+    std::map<word, std::unique_ptr<TimeSeriesWriter>> writers_;
+};
+
+} // namespace Foam
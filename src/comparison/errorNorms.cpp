@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <cmath>
+
+#include "FoamAdapter/comparison/errorNorms.hpp"
+#include "FoamAdapter/parallel/reduce.hpp"
+
+#include "NeoFOAM/core/error.hpp"
+
+namespace Foam
+{
+
+namespace detail
+{
+
+KOKKOS_INLINE_FUNCTION
+NeoFOAM::scalar magnitude(const NeoFOAM::scalar& value) { return Kokkos::fabs(value); }
+
+KOKKOS_INLINE_FUNCTION
+NeoFOAM::scalar magnitude(const NeoFOAM::Vector& value) { return NeoFOAM::mag(value); }
+
+} // namespace detail
+
+template<typename ValueType>
+ErrorNorms computeErrorNorms(
+    const NeoFOAM::Executor& exec,
+    std::span<const ValueType> values,
+    std::span<const ValueType> reference,
+    const NeoFOAM::scalar relFloor
+)
+{
+    NF_ASSERT_EQUAL(values.size(), reference.size());
+
+    ErrorNorms norms;
+    norms.size = values.size();
+    if (values.empty())
+    {
+        return norms;
+    }
+
+    using worst_t = Kokkos::MaxLoc<NeoFOAM::scalar, NeoFOAM::localIdx>;
+    NeoFOAM::scalar sumAbs = 0.0;
+    NeoFOAM::scalar sumSqr = 0.0;
+    NeoFOAM::scalar maxRel = 0.0;
+    typename worst_t::value_type worst;
+
+    detail::parallelReduce(
+        exec,
+        "computeErrorNorms",
+        {0, values.size()},
+        KOKKOS_LAMBDA(
+            const size_t i,
+            NeoFOAM::scalar& l1,
+            NeoFOAM::scalar& l2,
+            NeoFOAM::scalar& rel,
+            typename worst_t::value_type& linf
+        ) {
+            const NeoFOAM::scalar err = detail::magnitude(values[i] - reference[i]);
+            l1 += err;
+            l2 += err * err;
+            rel = Kokkos::fmax(rel, err / Kokkos::fmax(detail::magnitude(reference[i]), relFloor));
+            if (err > linf.val)
+            {
+                linf.val = err;
+                linf.loc = i;
+            }
+        },
+        Kokkos::Sum<NeoFOAM::scalar>(sumAbs),
+        Kokkos::Sum<NeoFOAM::scalar>(sumSqr),
+        Kokkos::Max<NeoFOAM::scalar>(maxRel),
+        worst_t(worst)
+    );
+
+    norms.l1 = sumAbs / values.size();
+    norms.l2 = std::sqrt(sumSqr / values.size());
+    norms.linf = worst.val;
+    norms.maxRel = maxRel;
+    norms.worstIdx = worst.loc;
+    return norms;
+}
+
+template ErrorNorms computeErrorNorms<NeoFOAM::scalar>(
+    const NeoFOAM::Executor&,
+    std::span<const NeoFOAM::scalar>,
+    std::span<const NeoFOAM::scalar>,
+    const NeoFOAM::scalar
+);
+
+template ErrorNorms computeErrorNorms<NeoFOAM::Vector>(
+    const NeoFOAM::Executor&,
+    std::span<const NeoFOAM::Vector>,
+    std::span<const NeoFOAM::Vector>,
+    const NeoFOAM::scalar
+);
+
+
+Ostream& operator<<(Ostream& os, const ComparisonReport& report)
+{
+    auto writeNorms = [&os](const char* region, const ErrorNorms& norms)
+    {
+        os << "    " << region << " (" << norms.size << "): L1 " << norms.l1 << " L2 " << norms.l2
+           << " Linf " << norms.linf << " maxRel " << norms.maxRel << nl;
+    };
+
+    os << "Comparison of " << report.name << nl;
+    writeNorms("internal", report.internal);
+    writeNorms("boundary", report.boundary);
+    os << "    worst cell: " << report.worstCell;
+    if (report.worstPatch >= 0)
+    {
+        os << " worst patch: " << report.worstPatchName << " (" << report.worstPatch
+           << ") face: " << report.worstPatchFace;
+    }
+    os << nl;
+    return os;
+}
+
+} // namespace Foam
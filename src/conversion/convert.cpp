@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // SPDX-FileCopyrightText: 2023 NeoFOAM authors
 
+#include <any>
+
 #include "FoamAdapter/conversion/convert.hpp"
 
 namespace Foam
@@ -44,6 +46,18 @@ NeoFOAM::TokenList convert(const Foam::ITstream& stream)
     return tokens;
 };
 
+NeoFOAM::scalar getScalar(const NeoFOAM::TokenList& tokens, const size_t i)
+{
+    try
+    {
+        return tokens.get<NeoFOAM::scalar>(i);
+    }
+    catch (const std::bad_any_cast&)
+    {
+        return tokens.get<Foam::label>(i);
+    }
+}
+
 // To Foam
 Foam::vector convert(const NeoFOAM::Vector& in) { return Foam::vector(in(0), in(1), in(2)); };
 
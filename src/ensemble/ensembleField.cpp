@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/ensemble/ensembleField.hpp"
+
+#include "NeoFOAM/core/error.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+EnsembleField::EnsembleField(
+    const NeoFOAM::Executor& exec,
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const NeoFOAM::label nMembers
+)
+    : exec_(exec)
+    , mesh_(mesh)
+    , nMembers_(nMembers)
+    , values_(exec, mesh.nCells() * nMembers)
+    , rhs_(exec, mesh.nCells() * nMembers)
+{
+    NeoFOAM::fill(values_, 0.0);
+}
+
+void EnsembleField::setMember(
+    const NeoFOAM::label member,
+    const NeoFOAM::Field<NeoFOAM::scalar>& cellValues
+)
+{
+    NF_ASSERT_EQUAL(cellValues.size(), mesh_.nCells());
+    const NeoFOAM::label nMembers = nMembers_;
+    auto values = values_.span();
+    const auto cell = cellValues.span();
+    NeoFOAM::parallelFor(
+        exec_,
+        {0, cell.size()},
+        KOKKOS_LAMBDA(const size_t celli) { values[celli * nMembers + member] = cell[celli]; }
+    );
+}
+
+void EnsembleField::getMember(
+    const NeoFOAM::label member,
+    NeoFOAM::Field<NeoFOAM::scalar>& cellValues
+) const
+{
+    NF_ASSERT_EQUAL(cellValues.size(), mesh_.nCells());
+    const NeoFOAM::label nMembers = nMembers_;
+    const auto values = values_.span();
+    auto cell = cellValues.span();
+    NeoFOAM::parallelFor(
+        exec_,
+        {0, cell.size()},
+        KOKKOS_LAMBDA(const size_t celli) { cell[celli] = values[celli * nMembers + member]; }
+    );
+}
+
+void EnsembleField::advanceUpwind(
+    const NeoFOAM::Field<NeoFOAM::scalar>& faceFlux,
+    const NeoFOAM::Field<NeoFOAM::scalar>& fluxScale,
+    const NeoFOAM::scalar dt
+)
+{
+    NF_ASSERT_EQUAL(faceFlux.size(), mesh_.nFaces());
+    NF_ASSERT_EQUAL(fluxScale.size(), nMembers_);
+
+    const size_t nMembers = nMembers_;
+    const size_t nInternalFaces = mesh_.nInternalFaces();
+    const size_t nBoundaryFaces = mesh_.nBoundaryFaces();
+    auto values = values_.span();
+    auto rhs = rhs_.span();
+    const auto flux = faceFlux.span();
+    const auto scale = fluxScale.span();
+    const auto owner = mesh_.faceOwner().span();
+    const auto neighbour = mesh_.faceNeighbour().span();
+    const auto faceCells = mesh_.boundaryMesh().faceCells().span();
+    const auto volume = mesh_.cellVolumes().span();
+
+    NeoFOAM::fill(rhs_, 0.0);
+
+    NeoFOAM::parallelFor(
+        exec_,
+        {0, nInternalFaces * nMembers},
+        KOKKOS_LAMBDA(const size_t i) {
+            const size_t facei = i / nMembers;
+            const size_t member = i % nMembers;
+            const size_t own = owner[facei] * nMembers + member;
+            const size_t nei = neighbour[facei] * nMembers + member;
+            const NeoFOAM::scalar f = scale[member] * flux[facei];
+            const NeoFOAM::scalar transport = f * (f >= 0 ? values[own] : values[nei]);
+            Kokkos::atomic_sub(&rhs[own], transport);
+            Kokkos::atomic_add(&rhs[nei], transport);
+        }
+    );
+
+    // zero gradient boundaries, the face value equals the owner value
+    NeoFOAM::parallelFor(
+        exec_,
+        {0, nBoundaryFaces * nMembers},
+        KOKKOS_LAMBDA(const size_t i) {
+            const size_t bfacei = i / nMembers;
+            const size_t member = i % nMembers;
+            const size_t own = faceCells[bfacei] * nMembers + member;
+            const NeoFOAM::scalar f = scale[member] * flux[nInternalFaces + bfacei];
+            Kokkos::atomic_sub(&rhs[own], f * values[own]);
+        }
+    );
+
+    NeoFOAM::parallelFor(
+        exec_,
+        {0, values.size()},
+        KOKKOS_LAMBDA(const size_t i) { values[i] += dt * rhs[i] / volume[i / nMembers]; }
+    );
+}
+
+} // namespace Foam
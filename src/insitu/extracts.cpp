@@ -0,0 +1,478 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <cstdint>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+#include "OSspecific.H"
+
+#include "FoamAdapter/insitu/extracts.hpp"
+#include "FoamAdapter/conversion/convert.hpp"
+#include "FoamAdapter/parallel/reduce.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+using ScalarVolumeField = fvcc::VolumeField<NeoFOAM::scalar>;
+
+// indices of the selected entries in [0, n) in ascending order
+template<typename Predicate>
+NeoFOAM::Field<NeoFOAM::label>
+compact(const NeoFOAM::Executor& exec, const size_t n, const Predicate selected)
+{
+    NeoFOAM::Field<NeoFOAM::label> indices(exec, n);
+    auto all = indices.span();
+    const NeoFOAM::label count = detail::parallelScan(
+        exec,
+        "Extract::compact",
+        {0, n},
+        KOKKOS_LAMBDA(const size_t i, NeoFOAM::label& partial, const bool final) {
+            if (selected(i))
+            {
+                if (final)
+                {
+                    all[partial] = i;
+                }
+                partial++;
+            }
+        }
+    );
+
+    NeoFOAM::Field<NeoFOAM::label> result(exec, count);
+    auto selectedIndices = result.span();
+    NeoFOAM::parallelFor(
+        exec,
+        {0, static_cast<size_t>(count)},
+        KOKKOS_LAMBDA(const size_t i) { selectedIndices[i] = all[i]; }
+    );
+    return result;
+}
+
+NeoFOAM::Field<NeoFOAM::label> decimatedCells(
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const NeoFOAM::label stride,
+    const NeoFOAM::Vector lower,
+    const NeoFOAM::Vector upper
+)
+{
+    const auto centres = mesh.cellCentres().span();
+    return compact(
+        mesh.exec(),
+        mesh.nCells(),
+        KOKKOS_LAMBDA(const size_t celli) {
+            const NeoFOAM::Vector& c = centres[celli];
+            bool inside = celli % stride == 0;
+            for (int d = 0; d < 3; d++)
+            {
+                inside = inside && c[d] >= lower[d] && c[d] <= upper[d];
+            }
+            return inside;
+        }
+    );
+}
+
+// the cells whose centre is closer to the plane than half their edge length
+NeoFOAM::Field<NeoFOAM::label> slicedCells(
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const NeoFOAM::Vector origin,
+    const NeoFOAM::Vector normal
+)
+{
+    const auto centres = mesh.cellCentres().span();
+    const auto volumes = mesh.cellVolumes().span();
+    return compact(
+        mesh.exec(),
+        mesh.nCells(),
+        KOKKOS_LAMBDA(const size_t celli) {
+            const NeoFOAM::Vector d = centres[celli] - origin;
+            const NeoFOAM::scalar dist = d[0] * normal[0] + d[1] * normal[1] + d[2] * normal[2];
+            return Kokkos::fabs(dist) <= 0.5 * Kokkos::cbrt(volumes[celli]);
+        }
+    );
+}
+
+// the internal faces whose owner and neighbour values are on different sides of the iso value
+NeoFOAM::Field<NeoFOAM::label> isoFaces(
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const ScalarVolumeField& isoField,
+    const NeoFOAM::scalar isoValue
+)
+{
+    const auto owner = mesh.faceOwner().span();
+    const auto neighbour = mesh.faceNeighbour().span();
+    const auto values = isoField.internalField().span();
+    return compact(
+        mesh.exec(),
+        mesh.nInternalFaces(),
+        KOKKOS_LAMBDA(const size_t facei) {
+            return (values[owner[facei]] < isoValue) != (values[neighbour[facei]] < isoValue);
+        }
+    );
+}
+
+// cell centres, projected onto the plane for slices
+NeoFOAM::Field<NeoFOAM::Vector> cellPoints(
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const NeoFOAM::Field<NeoFOAM::label>& cells,
+    const bool project,
+    const NeoFOAM::Vector origin,
+    const NeoFOAM::Vector normal
+)
+{
+    NeoFOAM::Field<NeoFOAM::Vector> points(mesh.exec(), cells.size());
+    const auto centres = mesh.cellCentres().span();
+    const auto cellIdx = cells.span();
+    auto out = points.span();
+    NeoFOAM::parallelFor(
+        mesh.exec(),
+        {0, cells.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            const NeoFOAM::Vector& c = centres[cellIdx[i]];
+            const NeoFOAM::Vector d = c - origin;
+            const NeoFOAM::scalar dist =
+                project ? d[0] * normal[0] + d[1] * normal[1] + d[2] * normal[2] : 0.0;
+            out[i] = c - dist * normal;
+        }
+    );
+    return points;
+}
+
+NeoFOAM::Field<NeoFOAM::scalar>
+cellValues(const NeoFOAM::Field<NeoFOAM::label>& cells, const ScalarVolumeField& field)
+{
+    NeoFOAM::Field<NeoFOAM::scalar> result(cells.exec(), cells.size());
+    const auto values = field.internalField().span();
+    const auto cellIdx = cells.span();
+    auto out = result.span();
+    NeoFOAM::parallelFor(
+        cells.exec(),
+        {0, cells.size()},
+        KOKKOS_LAMBDA(const size_t i) { out[i] = values[cellIdx[i]]; }
+    );
+    return result;
+}
+
+// position of the crossing on the line between the owner and neighbour cell centre
+NeoFOAM::Field<NeoFOAM::scalar> isoWeights(
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const NeoFOAM::Field<NeoFOAM::label>& faces,
+    const ScalarVolumeField& isoField,
+    const NeoFOAM::scalar isoValue
+)
+{
+    NeoFOAM::Field<NeoFOAM::scalar> weights(faces.exec(), faces.size());
+    const auto owner = mesh.faceOwner().span();
+    const auto neighbour = mesh.faceNeighbour().span();
+    const auto values = isoField.internalField().span();
+    const auto faceIdx = faces.span();
+    auto out = weights.span();
+    NeoFOAM::parallelFor(
+        faces.exec(),
+        {0, faces.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            const NeoFOAM::label facei = faceIdx[i];
+            const NeoFOAM::scalar a = values[owner[facei]] - isoValue;
+            const NeoFOAM::scalar b = values[neighbour[facei]] - isoValue;
+            out[i] = a / (a - b);
+        }
+    );
+    return weights;
+}
+
+template<typename ValueType>
+NeoFOAM::Field<ValueType> interpolateFaces(
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const NeoFOAM::Field<NeoFOAM::label>& faces,
+    const NeoFOAM::Field<NeoFOAM::scalar>& weights,
+    std::span<const ValueType> values
+)
+{
+    NeoFOAM::Field<ValueType> result(faces.exec(), faces.size());
+    const auto owner = mesh.faceOwner().span();
+    const auto neighbour = mesh.faceNeighbour().span();
+    const auto faceIdx = faces.span();
+    const auto w = weights.span();
+    auto out = result.span();
+    NeoFOAM::parallelFor(
+        faces.exec(),
+        {0, faces.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            const ValueType& a = values[owner[faceIdx[i]]];
+            const ValueType& b = values[neighbour[faceIdx[i]]];
+            out[i] = a + w[i] * (b - a);
+        }
+    );
+    return result;
+}
+
+pointField toPointField(const NeoFOAM::Field<NeoFOAM::Vector>& points)
+{
+    auto hostPoints = points.copyToHost();
+    pointField result(hostPoints.size());
+    forAll(result, pointi)
+    {
+        result[pointi] = convert(hostPoints.span()[pointi]);
+    }
+    return result;
+}
+
+scalarField toScalarField(const NeoFOAM::Field<NeoFOAM::scalar>& values)
+{
+    auto hostValues = values.copyToHost();
+    scalarField result(hostValues.size());
+    forAll(result, i)
+    {
+        result[i] = hostValues.span()[i];
+    }
+    return result;
+}
+
+const ScalarVolumeField&
+findField(const std::vector<const ScalarVolumeField*>& fields, const word& name)
+{
+    for (const auto* field : fields)
+    {
+        if (field->name == name)
+        {
+            return *field;
+        }
+    }
+    FatalErrorInFunction << "field " << name << " is not available for the extracts"
+                         << exit(FatalError);
+    return *fields.front();
+}
+
+// appends a block of the appended data section, i.e. its size followed by the raw data
+template<typename T>
+void appendBlock(std::string& data, const T* values, const size_t n)
+{
+    const uint64_t nBytes = n * sizeof(T);
+    data.append(reinterpret_cast<const char*>(&nBytes), sizeof(nBytes));
+    if (nBytes > 0)
+    {
+        data.append(reinterpret_cast<const char*>(values), nBytes);
+    }
+}
+
+}
+
+void writeVtp(const fileName& file, const ExtractData& data)
+{
+    const size_t nPoints = data.points.size();
+    std::vector<int64_t> connectivity(nPoints);
+    std::iota(connectivity.begin(), connectivity.end(), 0);
+    std::vector<int64_t> offsets(nPoints);
+    std::iota(offsets.begin(), offsets.end(), 1);
+
+    std::string appended;
+    std::ostringstream xml;
+    xml << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"LittleEndian\" "
+        << "header_type=\"UInt64\">\n"
+        << "<PolyData>\n"
+        << "<Piece NumberOfPoints=\"" << nPoints << "\" NumberOfVerts=\"" << nPoints << "\">\n"
+        << "<PointData>\n";
+    for (const auto& [name, values] : data.fields)
+    {
+        xml << "<DataArray type=\"Float64\" Name=\"" << name.c_str()
+            << "\" format=\"appended\" offset=\"" << appended.size() << "\"/>\n";
+        appendBlock(appended, values.cdata(), values.size());
+    }
+    xml << "</PointData>\n"
+        << "<Points>\n"
+        << "<DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"appended\" offset=\""
+        << appended.size() << "\"/>\n"
+        << "</Points>\n";
+    // an empty extract, e.g. an iso value outside the field range, writes an empty piece
+    appendBlock(appended, nPoints > 0 ? data.points.cdata()->cdata() : nullptr, 3 * nPoints);
+    xml << "<Verts>\n"
+        << "<DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" offset=\""
+        << appended.size() << "\"/>\n";
+    appendBlock(appended, connectivity.data(), nPoints);
+    xml << "<DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" offset=\""
+        << appended.size() << "\"/>\n"
+        << "</Verts>\n"
+        << "</Piece>\n"
+        << "</PolyData>\n"
+        << "<AppendedData encoding=\"raw\">\n_";
+    appendBlock(appended, offsets.data(), nPoints);
+
+    std::ofstream os(file, std::ios::binary);
+    os << xml.str();
+    os.write(appended.data(), appended.size());
+    os << "\n</AppendedData>\n</VTKFile>\n";
+    if (!os)
+    {
+        FatalErrorInFunction << "cannot write " << file << exit(FatalError);
+    }
+}
+
+void writePvtp(const fileName& file, const wordList& fieldNames, const fileNameList& pieces)
+{
+    std::ofstream os(file);
+    os << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"PPolyData\" version=\"1.0\" byte_order=\"LittleEndian\" "
+       << "header_type=\"UInt64\">\n"
+       << "<PPolyData GhostLevel=\"0\">\n"
+       << "<PPointData>\n";
+    for (const word& name : fieldNames)
+    {
+        os << "<PDataArray type=\"Float64\" Name=\"" << name.c_str() << "\"/>\n";
+    }
+    os << "</PPointData>\n"
+       << "<PPoints>\n"
+       << "<PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n"
+       << "</PPoints>\n";
+    for (const fileName& piece : pieces)
+    {
+        os << "<Piece Source=\"" << piece.c_str() << "\"/>\n";
+    }
+    os << "</PPolyData>\n</VTKFile>\n";
+}
+
+Extract::Extract(const word& name, const MeshAdapter& mesh, const dictionary& dict)
+    : mesh_(mesh)
+    , name_(name)
+    , type_(Type::decimate)
+    , fields_(dict.get<wordList>("fields"))
+    , interval_(max(dict.getOrDefault<label>("interval", 1), 1))
+    , box_(mesh.bounds())
+    , point_(Zero)
+    , normal_(Zero)
+{
+    const word type = dict.get<word>("type");
+    if (type == "decimate")
+    {
+        type_ = Type::decimate;
+        stride_ = max(dict.getOrDefault<label>("stride", 1), 1);
+        dict.readIfPresent("box", box_);
+    }
+    else if (type == "slice")
+    {
+        type_ = Type::slice;
+        point_ = dict.get<point>("point");
+        normal_ = normalised(dict.get<vector>("normal"));
+    }
+    else if (type == "iso")
+    {
+        type_ = Type::iso;
+        isoField_ = dict.get<word>("isoField");
+        isoValue_ = dict.get<scalar>("isoValue");
+    }
+    else
+    {
+        FatalIOErrorInFunction(dict) << "unknown type " << type << " of extract " << name
+                                     << ", valid types are decimate, slice and iso"
+                                     << exit(FatalIOError);
+    }
+}
+
+NeoFOAM::Field<NeoFOAM::label> Extract::selectCells() const
+{
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh_.nfMesh();
+    if (type_ == Type::decimate)
+    {
+        return decimatedCells(nfMesh, stride_, convert(box_.min()), convert(box_.max()));
+    }
+    return slicedCells(nfMesh, convert(point_), convert(normal_));
+}
+
+ExtractData
+Extract::compute(const std::vector<const fvcc::VolumeField<NeoFOAM::scalar>*>& fields) const
+{
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh_.nfMesh();
+    ExtractData data;
+
+    if (type_ == Type::iso)
+    {
+        const ScalarVolumeField& isoField = findField(fields, isoField_);
+        const auto faces = isoFaces(nfMesh, isoField, isoValue_);
+        const auto weights = isoWeights(nfMesh, faces, isoField, isoValue_);
+        data.points = toPointField(interpolateFaces<NeoFOAM::Vector>(
+            nfMesh, faces, weights, nfMesh.cellCentres().span()
+        ));
+        for (const word& name : fields_)
+        {
+            const auto values = findField(fields, name).internalField().span();
+            data.fields.emplace_back(
+                name,
+                toScalarField(interpolateFaces<NeoFOAM::scalar>(nfMesh, faces, weights, values))
+            );
+        }
+        return data;
+    }
+
+    if (!cells_)
+    {
+        cells_ = std::make_unique<NeoFOAM::Field<NeoFOAM::label>>(selectCells());
+    }
+    data.points = toPointField(
+        cellPoints(nfMesh, *cells_, type_ == Type::slice, convert(point_), convert(normal_))
+    );
+    for (const word& name : fields_)
+    {
+        data.fields.emplace_back(name, toScalarField(cellValues(*cells_, findField(fields, name))));
+    }
+    return data;
+}
+
+Extracts::Extracts(const MeshAdapter& mesh, const dictionary& dict, WorkStealingPool* pool)
+    : mesh_(mesh), pool_(pool), extracts_()
+{
+    const dictionary extractsDict = dict.subOrEmptyDict("extracts");
+    for (const word& name : extractsDict.toc())
+    {
+        extracts_.push_back(std::make_unique<Extract>(name, mesh, extractsDict.subDict(name)));
+    }
+}
+
+void Extracts::write(const std::vector<const fvcc::VolumeField<NeoFOAM::scalar>*>& fields)
+{
+    const Time& time = mesh_.time();
+    for (const auto& extract : extracts_)
+    {
+        if (!extract->due(time.timeIndex()))
+        {
+            continue;
+        }
+        auto data = std::make_shared<ExtractData>(extract->compute(fields));
+
+        const fileName dir = time.globalPath() / "postProcessing" / "extracts" / extract->name();
+        const word base = extract->name() + "_" + Foam::name(time.timeIndex());
+        mkDir(dir);
+        fileName file = dir / base + ".vtp";
+        if (Pstream::parRun())
+        {
+            fileNameList pieces(Pstream::nProcs());
+            forAll(pieces, proci)
+            {
+                pieces[proci] = base + "_" + Foam::name(proci) + ".vtp";
+            }
+            if (Pstream::master())
+            {
+                writePvtp(dir / base + ".pvtp", extract->fields(), pieces);
+            }
+            file = dir / pieces[Pstream::myProcNo()];
+        }
+
+        Info << "Writing extract " << extract->name() << " with "
+             << returnReduce(data->points.size(), sumOp<label>()) << " points" << endl;
+        if (pool_)
+        {
+            pool_->submit([file, data]() { writeVtp(file, *data); });
+        }
+        else
+        {
+            writeVtp(file, *data);
+        }
+    }
+}
+
+} // namespace Foam
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <vector>
+
+#include "emptyPolyPatch.H"
+#include "wedgePolyPatch.H"
+
+#include "FoamAdapter/interpolation/cellToPoint.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+struct Source
+{
+    label index;
+    scalar weight;
+};
+
+// inverse distance weights of the boundary faces of the points on interpolating patches
+std::vector<std::vector<Source>> boundarySources(const MeshAdapter& mesh)
+{
+    const pointField& points = mesh.points();
+    const faceList& faces = mesh.faces();
+    const fvBoundaryMesh& bMesh = mesh.boundary();
+    const std::vector<NeoFOAM::localIdx> offset = computeOffset(mesh);
+
+    std::vector<std::vector<Source>> sources(mesh.nPoints());
+    forAll(bMesh, patchi)
+    {
+        const polyPatch& pp = bMesh[patchi].patch();
+        if (pp.coupled() || isA<emptyPolyPatch>(pp) || isA<wedgePolyPatch>(pp))
+        {
+            continue;
+        }
+        const vectorField& Cf = pp.faceCentres();
+        forAll(pp, facei)
+        {
+            for (const label pointi : faces[pp.start() + facei])
+            {
+                sources[pointi].push_back(
+                    {label(offset[patchi]) + facei, 1.0 / mag(points[pointi] - Cf[facei])}
+                );
+            }
+        }
+    }
+    return sources;
+}
+
+}
+
+CellToPointInterpolation::CellToPointInterpolation(const MeshAdapter& mesh)
+    : nCells_(mesh.nCells())
+    , offsets_(mesh.exec(), 0)
+    , sources_(mesh.exec(), 0)
+    , weights_(mesh.exec(), 0)
+{
+    const pointField& points = mesh.points();
+    const vectorField& C = mesh.cellCentres();
+    const labelListList& pointCells = mesh.pointCells();
+    const std::vector<std::vector<Source>> patchSources = boundarySources(mesh);
+
+    std::vector<NeoFOAM::label> offsets {0};
+    std::vector<NeoFOAM::label> sources;
+    std::vector<NeoFOAM::scalar> weights;
+    sources.reserve(8 * points.size());
+    weights.reserve(8 * points.size());
+
+    std::vector<Source> pointSources;
+    forAll(points, pointi)
+    {
+        pointSources = patchSources[pointi];
+        if (pointSources.empty())
+        {
+            for (const label celli : pointCells[pointi])
+            {
+                pointSources.push_back({celli, 1.0 / mag(points[pointi] - C[celli])});
+            }
+        }
+        else
+        {
+            for (auto& source : pointSources)
+            {
+                source.index += nCells_;
+            }
+        }
+
+        scalar sumWeights = 0;
+        for (const auto& source : pointSources)
+        {
+            sumWeights += source.weight;
+        }
+        for (const auto& source : pointSources)
+        {
+            sources.push_back(source.index);
+            weights.push_back(source.weight / sumWeights);
+        }
+        offsets.push_back(sources.size());
+    }
+
+    const NeoFOAM::Executor exec = mesh.exec();
+    offsets_ = NeoFOAM::Field<NeoFOAM::label>(exec, offsets.data(), offsets.size());
+    sources_ = NeoFOAM::Field<NeoFOAM::label>(exec, sources.data(), sources.size());
+    weights_ = NeoFOAM::Field<NeoFOAM::scalar>(exec, weights.data(), weights.size());
+}
+
+template<typename ValueType>
+void CellToPointInterpolation::interpolate(
+    const fvcc::VolumeField<ValueType>& vf,
+    NeoFOAM::Field<ValueType>& pf
+) const
+{
+    const NeoFOAM::label nCells = nCells_;
+    const auto offsets = offsets_.span();
+    const auto sources = sources_.span();
+    const auto weights = weights_.span();
+    const auto cellValues = vf.internalField().span();
+    const auto boundaryValues = vf.boundaryField().value().span();
+    auto values = pf.span();
+    NeoFOAM::parallelFor(
+        vf.exec(),
+        {0, values.size()},
+        KOKKOS_LAMBDA(const size_t pointi) {
+            ValueType value {};
+            for (NeoFOAM::label j = offsets[pointi]; j < offsets[pointi + 1]; j++)
+            {
+                const NeoFOAM::label source = sources[j];
+                value += weights[j]
+                       * (source < nCells ? cellValues[source] : boundaryValues[source - nCells]);
+            }
+            values[pointi] = value;
+        }
+    );
+}
+
+template<typename ValueType>
+NeoFOAM::Field<ValueType>
+CellToPointInterpolation::interpolate(const fvcc::VolumeField<ValueType>& vf) const
+{
+    NeoFOAM::Field<ValueType> pf(vf.exec(), nPoints());
+    interpolate(vf, pf);
+    return pf;
+}
+
+template void CellToPointInterpolation::interpolate<NeoFOAM::scalar>(
+    const fvcc::VolumeField<NeoFOAM::scalar>&, NeoFOAM::Field<NeoFOAM::scalar>&
+) const;
+
+template void CellToPointInterpolation::interpolate<NeoFOAM::Vector>(
+    const fvcc::VolumeField<NeoFOAM::Vector>&, NeoFOAM::Field<NeoFOAM::Vector>&
+) const;
+
+template NeoFOAM::Field<NeoFOAM::scalar>
+CellToPointInterpolation::interpolate<NeoFOAM::scalar>(const fvcc::VolumeField<NeoFOAM::scalar>&)
+    const;
+
+template NeoFOAM::Field<NeoFOAM::Vector>
+CellToPointInterpolation::interpolate<NeoFOAM::Vector>(const fvcc::VolumeField<NeoFOAM::Vector>&)
+    const;
+
+} // namespace Foam
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "error.H"
+
+#include "FoamAdapter/interpolation/limitedSchemes.hpp"
+#include "FoamAdapter/conversion/convert.hpp"
+#include "FoamAdapter/mesh/nonOrthGeometry.hpp"
+#include "FoamAdapter/operators/gradScheme.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+// sets the boundary faces of the surface field to the boundary values of the volume field
+void boundaryValues(
+    const fvcc::VolumeField<NeoFOAM::scalar>& volField,
+    fvcc::SurfaceField<NeoFOAM::scalar>& surfaceField
+)
+{
+    const size_t nInternalFaces = volField.mesh().nInternalFaces();
+    const auto bValues = volField.boundaryField().value().span();
+    auto result = surfaceField.internalField().span();
+
+    NeoFOAM::parallelFor(
+        volField.exec(),
+        {nInternalFaces, result.size()},
+        KOKKOS_LAMBDA(const size_t facei) { result[facei] = bValues[facei - nInternalFaces]; }
+    );
+}
+
+}
+
+LimitedLinearLimiter::LimitedLinearLimiter(const NeoFOAM::Input& input)
+{
+    // limitedLinear k, the coefficient is the last token
+    const NeoFOAM::scalar k =
+        std::holds_alternative<NeoFOAM::Dictionary>(input)
+            ? std::get<NeoFOAM::Dictionary>(input).get<NeoFOAM::scalar>("k")
+            : getScalar(
+                  std::get<NeoFOAM::TokenList>(input),
+                  std::get<NeoFOAM::TokenList>(input).size() - 1
+              );
+    if (k < 0 || k > 1)
+    {
+        FatalErrorInFunction << "coefficient = " << k << " should be >= 0 and <= 1"
+                             << exit(FatalError);
+    }
+    twoByk = 2.0 / Kokkos::max(k, SMALL);
+}
+
+template<typename Limiter>
+LimitedInterpolation<Limiter>::LimitedInterpolation(
+    const NeoFOAM::Executor& exec,
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const NeoFOAM::Input& input
+)
+    : Base(exec, mesh)
+    , input_(input)
+    , limiter_(input)
+    , linearWeights_(computeLinearWeights(mesh))
+    , grad_(exec, mesh)
+    , gradient_(gradientField(exec, mesh))
+{}
+
+template<typename Limiter>
+void LimitedInterpolation<Limiter>::interpolate(
+    const fvcc::VolumeField<NeoFOAM::scalar>&,
+    fvcc::SurfaceField<NeoFOAM::scalar>&
+) const
+{
+    FatalErrorInFunction << Limiter::name() << " requires the face flux" << exit(FatalError);
+}
+
+template<typename Limiter>
+void LimitedInterpolation<Limiter>::interpolate(
+    const fvcc::SurfaceField<NeoFOAM::scalar>& faceFlux,
+    const fvcc::VolumeField<NeoFOAM::scalar>& volField,
+    fvcc::SurfaceField<NeoFOAM::scalar>& surfaceField
+) const
+{
+    NeoFOAM::fill(gradient_.internalField(), NeoFOAM::Vector(0.0, 0.0, 0.0));
+    grad_.grad(volField, gradient_);
+
+    const NeoFOAM::UnstructuredMesh& mesh = volField.mesh();
+    const auto owner = mesh.faceOwner().span();
+    const auto neighbour = mesh.faceNeighbour().span();
+    const auto C = mesh.cellCentres().span();
+    const auto flux = faceFlux.internalField().span();
+    const auto phi = volField.internalField().span();
+    const auto gradPhi = gradient_.internalField().span();
+    const auto cdWeights = linearWeights_.span();
+    const Limiter limiter = limiter_;
+    auto result = surfaceField.internalField().span();
+
+    NeoFOAM::parallelFor(
+        volField.exec(),
+        {0, cdWeights.size()},
+        KOKKOS_LAMBDA(const size_t facei) {
+            const NeoFOAM::label own = owner[facei];
+            const NeoFOAM::label nei = neighbour[facei];
+            const NeoFOAM::scalar phiP = phi[own];
+            const NeoFOAM::scalar phiN = phi[nei];
+
+            // r of NVDTVD, i.e. of the upwind cell gradient
+            const NeoFOAM::Vector d = C[nei] - C[own];
+            const NeoFOAM::scalar gradf = phiN - phiP;
+            const NeoFOAM::scalar gradcf = flux[facei] > 0 ? d & gradPhi[own] : d & gradPhi[nei];
+            NeoFOAM::scalar r;
+            if (Kokkos::abs(gradcf) >= 1000.0 * Kokkos::abs(gradf))
+            {
+                const NeoFOAM::scalar signs =
+                    (gradcf >= 0 ? 1.0 : -1.0) * (gradf >= 0 ? 1.0 : -1.0);
+                r = 2.0 * 1000.0 * signs - 1.0;
+            }
+            else
+            {
+                r = 2.0 * (gradcf / gradf) - 1.0;
+            }
+
+            const NeoFOAM::scalar lim = limiter(r);
+            const NeoFOAM::scalar w =
+                lim * cdWeights[facei] + (1.0 - lim) * (flux[facei] >= 0 ? 1.0 : 0.0);
+            result[facei] = w * phiP + (1.0 - w) * phiN;
+        }
+    );
+    boundaryValues(volField, surfaceField);
+}
+
+template<typename Limiter>
+std::unique_ptr<fvcc::SurfaceInterpolationFactory> LimitedInterpolation<Limiter>::clone() const
+{
+    return std::make_unique<LimitedInterpolation<Limiter>>(*this);
+}
+
+template class LimitedInterpolation<LimitedLinearLimiter>;
+template class LimitedInterpolation<VanLeerLimiter>;
+
+LinearUpwind::LinearUpwind(
+    const NeoFOAM::Executor& exec,
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const NeoFOAM::Input& input
+)
+    : Base(exec, mesh), input_(input), grad_(exec, mesh), gradient_(gradientField(exec, mesh))
+{
+    // once per run, the kernel may be created in every time step
+    static bool warned = false;
+    if (!warned && std::holds_alternative<NeoFOAM::TokenList>(input))
+    {
+        const NeoFOAM::TokenList& tokens = std::get<NeoFOAM::TokenList>(input);
+        WarningInFunction << "linearUpwind computes the gradient "
+                          << tokens.get<std::string>(tokens.size() - 1)
+                          << " with Gauss linear, its gradSchemes entry is not applied" << endl;
+        warned = true;
+    }
+}
+
+void LinearUpwind::interpolate(
+    const fvcc::VolumeField<NeoFOAM::scalar>&,
+    fvcc::SurfaceField<NeoFOAM::scalar>&
+) const
+{
+    FatalErrorInFunction << "linearUpwind requires the face flux" << exit(FatalError);
+}
+
+void LinearUpwind::interpolate(
+    const fvcc::SurfaceField<NeoFOAM::scalar>& faceFlux,
+    const fvcc::VolumeField<NeoFOAM::scalar>& volField,
+    fvcc::SurfaceField<NeoFOAM::scalar>& surfaceField
+) const
+{
+    NeoFOAM::fill(gradient_.internalField(), NeoFOAM::Vector(0.0, 0.0, 0.0));
+    grad_.grad(volField, gradient_);
+
+    const NeoFOAM::UnstructuredMesh& mesh = volField.mesh();
+    const size_t nInternalFaces = mesh.nInternalFaces();
+    const auto owner = mesh.faceOwner().span();
+    const auto neighbour = mesh.faceNeighbour().span();
+    const auto C = mesh.cellCentres().span();
+    const auto Cf = mesh.faceCentres().span();
+    const auto flux = faceFlux.internalField().span();
+    const auto phi = volField.internalField().span();
+    const auto gradPhi = gradient_.internalField().span();
+    auto result = surfaceField.internalField().span();
+
+    NeoFOAM::parallelFor(
+        volField.exec(),
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const size_t facei) {
+            // the upwind weight is pos0 of the flux, the correction uses the neighbour at 0
+            const NeoFOAM::label own = owner[facei];
+            const NeoFOAM::label nei = neighbour[facei];
+            const NeoFOAM::scalar upwind = flux[facei] >= 0 ? phi[own] : phi[nei];
+            const NeoFOAM::label celli = flux[facei] > 0 ? own : nei;
+            result[facei] = upwind + ((Cf[facei] - C[celli]) & gradPhi[celli]);
+        }
+    );
+    boundaryValues(volField, surfaceField);
+}
+
+std::unique_ptr<fvcc::SurfaceInterpolationFactory> LinearUpwind::clone() const
+{
+    return std::make_unique<LinearUpwind>(*this);
+}
+
+} // namespace Foam
@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "error.H"
+
+#include "FoamAdapter/matrix/lduSolver.hpp"
+#include "FoamAdapter/parallel/reduce.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+NeoFOAM::scalar sumMag(const NeoFOAM::Field<NeoFOAM::scalar>& field)
+{
+    const auto values = field.span();
+    NeoFOAM::scalar sum = 0;
+    detail::parallelReduce(
+        field.exec(),
+        "LduSolver::sumMag",
+        {0, values.size()},
+        KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) { lsum += Kokkos::abs(values[i]); },
+        Kokkos::Sum<NeoFOAM::scalar>(sum)
+    );
+    return sum;
+}
+
+NeoFOAM::scalar
+sumProd(const NeoFOAM::Field<NeoFOAM::scalar>& a, const NeoFOAM::Field<NeoFOAM::scalar>& b)
+{
+    const auto aValues = a.span();
+    const auto bValues = b.span();
+    NeoFOAM::scalar sum = 0;
+    detail::parallelReduce(
+        a.exec(),
+        "LduSolver::sumProd",
+        {0, aValues.size()},
+        KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) { lsum += aValues[i] * bValues[i]; },
+        Kokkos::Sum<NeoFOAM::scalar>(sum)
+    );
+    return sum;
+}
+
+// lduMatrix::solver::normFactor, the residual of the system compared to a uniform solution
+NeoFOAM::scalar normFactor(
+    const CellConnectivity& connectivity,
+    const LduSystem& system,
+    const NeoFOAM::Field<NeoFOAM::scalar>& x,
+    const NeoFOAM::Field<NeoFOAM::scalar>& Ax
+)
+{
+    const auto xValues = x.span();
+    NeoFOAM::scalar xSum = 0;
+    detail::parallelReduce(
+        x.exec(),
+        "LduSolver::average",
+        {0, xValues.size()},
+        KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) { lsum += xValues[i]; },
+        Kokkos::Sum<NeoFOAM::scalar>(xSum)
+    );
+    NeoFOAM::Field<NeoFOAM::scalar> xRef(x.exec(), x.size());
+    NeoFOAM::fill(xRef, xSum / Kokkos::max(NeoFOAM::scalar(xValues.size()), 1.0));
+    NeoFOAM::Field<NeoFOAM::scalar> AxRef(x.exec(), x.size());
+    Amul(connectivity, system, xRef, AxRef);
+
+    const auto wA = Ax.span();
+    const auto pA = AxRef.span();
+    const auto source = system.source.span();
+    NeoFOAM::scalar sum = 0;
+    detail::parallelReduce(
+        x.exec(),
+        "LduSolver::normFactor",
+        {0, wA.size()},
+        KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) {
+            lsum += Kokkos::abs(wA[i] - pA[i]) + Kokkos::abs(source[i] - pA[i]);
+        },
+        Kokkos::Sum<NeoFOAM::scalar>(sum)
+    );
+    return sum + 1e-20;
+}
+
+// r = source - Ax
+void residual(
+    const LduSystem& system,
+    const NeoFOAM::Field<NeoFOAM::scalar>& Ax,
+    NeoFOAM::Field<NeoFOAM::scalar>& r
+)
+{
+    const auto source = system.source.span();
+    const auto AxValues = Ax.span();
+    auto rValues = r.span();
+    NeoFOAM::parallelFor(
+        r.exec(),
+        {0, rValues.size()},
+        KOKKOS_LAMBDA(const size_t i) { rValues[i] = source[i] - AxValues[i]; }
+    );
+}
+
+}
+
+Ostream& operator<<(Ostream& os, const SolverPerformance& performance)
+{
+    os << performance.solverName << ":  Solving for " << performance.fieldName
+       << ", Initial residual = " << performance.initialResidual
+       << ", Final residual = " << performance.finalResidual
+       << ", No Iterations " << performance.nIterations;
+    return os;
+}
+
+LduSolver::LduSolver(const CellConnectivity& connectivity, const dictionary& solverDict)
+    : connectivity_(connectivity)
+    , solverName_(solverDict.get<word>("solver"))
+    , tolerance_(solverDict.getOrDefault<scalar>("tolerance", 1e-6))
+    , relTol_(solverDict.getOrDefault<scalar>("relTol", 0))
+    , maxIter_(solverDict.getOrDefault<label>("maxIter", 1000))
+    , minIter_(solverDict.getOrDefault<label>("minIter", 0))
+{
+    if (solverName_ == "PCG")
+    {
+        const word preconditioner = solverDict.getOrDefault<word>("preconditioner", "diagonal");
+        if (preconditioner != "diagonal" && preconditioner != "DIC" && preconditioner != "none")
+        {
+            FatalIOErrorInFunction(solverDict)
+                << "unsupported preconditioner " << preconditioner
+                << ", valid preconditioners are diagonal, DIC and none" << exit(FatalIOError);
+        }
+    }
+    else if (solverName_ == "smoothSolver")
+    {
+        const word smoother = solverDict.getOrDefault<word>("smoother", "Jacobi");
+        if (smoother != "Jacobi" && smoother != "symGaussSeidel" && smoother != "GaussSeidel")
+        {
+            FatalIOErrorInFunction(solverDict)
+                << "unsupported smoother " << smoother
+                << ", valid smoothers are Jacobi, GaussSeidel and symGaussSeidel"
+                << exit(FatalIOError);
+        }
+    }
+    else
+    {
+        FatalIOErrorInFunction(solverDict) << "unknown solver " << solverName_
+                                           << ", valid solvers are PCG and smoothSolver"
+                                           << exit(FatalIOError);
+    }
+}
+
+bool LduSolver::converged(const SolverPerformance& performance) const
+{
+    return performance.finalResidual < tolerance_
+        || (relTol_ > 0 && performance.finalResidual < relTol_ * performance.initialResidual);
+}
+
+SolverPerformance LduSolver::solve(
+    const LduSystem& system, NeoFOAM::Field<NeoFOAM::scalar>& x, const word& fieldName
+) const
+{
+    SolverPerformance performance;
+    performance.solverName = solverName_;
+    performance.fieldName = fieldName;
+
+    NeoFOAM::Field<NeoFOAM::scalar> Ax(x.exec(), x.size());
+    NeoFOAM::Field<NeoFOAM::scalar> r(x.exec(), x.size());
+    Amul(connectivity_, system, x, Ax);
+    residual(system, Ax, r);
+    const NeoFOAM::scalar norm = normFactor(connectivity_, system, x, Ax);
+    performance.initialResidual = sumMag(r) / norm;
+    performance.finalResidual = performance.initialResidual;
+
+    if (minIter_ > 0 || !converged(performance))
+    {
+        if (solverName_ == "PCG")
+        {
+            pcg(system, x, norm, performance);
+        }
+        else
+        {
+            jacobi(system, x, norm, performance);
+        }
+    }
+    performance.converged = converged(performance);
+    return performance;
+}
+
+void LduSolver::pcg(
+    const LduSystem& system,
+    NeoFOAM::Field<NeoFOAM::scalar>& x,
+    const NeoFOAM::scalar normFactor,
+    SolverPerformance& performance
+) const
+{
+    const NeoFOAM::Executor exec = x.exec();
+    const size_t nCells = x.size();
+    NeoFOAM::Field<NeoFOAM::scalar> rA(exec, nCells);
+    NeoFOAM::Field<NeoFOAM::scalar> wA(exec, nCells);
+    NeoFOAM::Field<NeoFOAM::scalar> pA(exec, nCells);
+    Amul(connectivity_, system, x, wA);
+    residual(system, wA, rA);
+    NeoFOAM::fill(pA, 0.0);
+
+    const auto diag = system.diag.span();
+    auto xValues = x.span();
+    auto rAValues = rA.span();
+    auto wAValues = wA.span();
+    auto pAValues = pA.span();
+    NeoFOAM::scalar wArAold = 0;
+
+    do
+    {
+        // diagonal preconditioning
+        NeoFOAM::parallelFor(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const size_t i) { wAValues[i] = rAValues[i] / diag[i]; }
+        );
+        const NeoFOAM::scalar wArA = sumProd(wA, rA);
+        const NeoFOAM::scalar beta = performance.nIterations == 0 ? 0.0 : wArA / wArAold;
+        wArAold = wArA;
+        NeoFOAM::parallelFor(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const size_t i) { pAValues[i] = wAValues[i] + beta * pAValues[i]; }
+        );
+
+        Amul(connectivity_, system, pA, wA);
+        const NeoFOAM::scalar wApA = sumProd(wA, pA);
+        if (Kokkos::abs(wApA) / normFactor < VSMALL)
+        {
+            break;
+        }
+
+        const NeoFOAM::scalar alpha = wArA / wApA;
+        NeoFOAM::parallelFor(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const size_t i) {
+                xValues[i] += alpha * pAValues[i];
+                rAValues[i] -= alpha * wAValues[i];
+            }
+        );
+        performance.finalResidual = sumMag(rA) / normFactor;
+    } while ((++performance.nIterations < maxIter_ && !converged(performance))
+             || performance.nIterations < minIter_);
+}
+
+void LduSolver::jacobi(
+    const LduSystem& system,
+    NeoFOAM::Field<NeoFOAM::scalar>& x,
+    const NeoFOAM::scalar normFactor,
+    SolverPerformance& performance
+) const
+{
+    const NeoFOAM::Executor exec = x.exec();
+    const size_t nCells = x.size();
+    NeoFOAM::Field<NeoFOAM::scalar> Ax(exec, nCells);
+    NeoFOAM::Field<NeoFOAM::scalar> r(exec, nCells);
+
+    const auto diag = system.diag.span();
+    const auto rValues = r.span();
+    auto xValues = x.span();
+
+    Amul(connectivity_, system, x, Ax);
+    residual(system, Ax, r);
+
+    do
+    {
+        // x_new = x + (source - A x) / diag, i.e. a sweep with the old values
+        NeoFOAM::parallelFor(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const size_t i) { xValues[i] += rValues[i] / diag[i]; }
+        );
+        Amul(connectivity_, system, x, Ax);
+        residual(system, Ax, r);
+        performance.finalResidual = sumMag(r) / normFactor;
+    } while ((++performance.nIterations < maxIter_ && !converged(performance))
+             || performance.nIterations < minIter_);
+}
+
+} // namespace Foam
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/matrix/lduSystem.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+LduSystem::LduSystem(const NeoFOAM::UnstructuredMesh& mesh)
+    : diag(mesh.exec(), mesh.nCells())
+    , lower(mesh.exec(), mesh.nInternalFaces())
+    , upper(mesh.exec(), mesh.nInternalFaces())
+    , source(mesh.exec(), mesh.nCells())
+{
+    NeoFOAM::fill(diag, 0.0);
+    NeoFOAM::fill(lower, 0.0);
+    NeoFOAM::fill(upper, 0.0);
+    NeoFOAM::fill(source, 0.0);
+}
+
+void Amul(
+    const CellConnectivity& connectivity,
+    const LduSystem& system,
+    const NeoFOAM::Field<NeoFOAM::scalar>& x,
+    NeoFOAM::Field<NeoFOAM::scalar>& Ax
+)
+{
+    const auto offsets = connectivity.offsets.span();
+    const auto faces = connectivity.faces.span();
+    const auto cells = connectivity.cells.span();
+    const auto signs = connectivity.signs.span();
+    const auto diag = system.diag.span();
+    const auto lower = system.lower.span();
+    const auto upper = system.upper.span();
+    const auto psi = x.span();
+    auto result = Ax.span();
+
+    NeoFOAM::parallelFor(
+        x.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            NeoFOAM::scalar sum = diag[celli] * psi[celli];
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                const NeoFOAM::label cellj = cells[j];
+                if (cellj >= 0)
+                {
+                    // upper is the coefficient of the owner row, lower of the neighbour row
+                    const NeoFOAM::label facei = faces[j];
+                    sum += (signs[j] > 0 ? upper[facei] : lower[facei]) * psi[cellj];
+                }
+            }
+            result[celli] = sum;
+        }
+    );
+}
+
+void setReference(LduSystem& system, const NeoFOAM::label celli, const NeoFOAM::scalar value)
+{
+    if (celli < 0)
+    {
+        return;
+    }
+    auto diag = system.diag.span();
+    auto source = system.source.span();
+
+    NeoFOAM::parallelFor(
+        system.diag.exec(),
+        {size_t(celli), size_t(celli) + 1},
+        KOKKOS_LAMBDA(const size_t i) {
+            source[i] += diag[i] * value;
+            diag[i] += diag[i];
+        }
+    );
+}
+
+void relax(
+    LduSystem& system, const NeoFOAM::Field<NeoFOAM::scalar>& psi, const NeoFOAM::scalar alpha
+)
+{
+    const auto psiValues = psi.span();
+    auto diag = system.diag.span();
+    auto source = system.source.span();
+
+    NeoFOAM::parallelFor(
+        psi.exec(),
+        {0, diag.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            const NeoFOAM::scalar relaxedDiag = diag[celli] / alpha;
+            source[celli] += (relaxedDiag - diag[celli]) * psiValues[celli];
+            diag[celli] = relaxedDiag;
+        }
+    );
+}
+
+} // namespace Foam
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "FoamAdapter/memory/hugePages.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+// size of a transparent huge page on x86_64 and aarch64 with 4k base pages
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+std::atomic<HugePagePolicy> policy_ = HugePagePolicy::none;
+std::atomic<size_t> minBytes_ = 2 * hugePageSize;
+std::atomic<size_t> advisedBytes_ = 0;
+
+}
+
+void setHugePagePolicy(const HugePagePolicy policy, const size_t minBytes)
+{
+    policy_ = policy;
+    minBytes_ = std::max(minBytes, hugePageSize);
+}
+
+HugePagePolicy hugePagePolicy() { return policy_; }
+
+void readHugePagePolicy(const dictionary& controlDict)
+{
+    const dictionary* dict = controlDict.findDict("hugePages");
+    if (!dict)
+    {
+        return;
+    }
+
+    const word policyName = dict->getOrDefault<word>("policy", "none");
+    const label minBytes = dict->getOrDefault<label>("minSize", 2 * hugePageSize);
+    if (minBytes < 0)
+    {
+        FatalIOErrorInFunction(*dict) << "minSize " << minBytes << " is negative"
+                                      << exit(FatalIOError);
+    }
+    if (policyName == "none")
+    {
+        setHugePagePolicy(HugePagePolicy::none, minBytes);
+    }
+    else if (policyName == "transparent")
+    {
+#if !defined(MADV_HUGEPAGE)
+        WarningInFunction << "transparent huge pages are not supported on this platform" << endl;
+#endif
+        setHugePagePolicy(HugePagePolicy::transparent, minBytes);
+    }
+    else
+    {
+        FatalIOErrorInFunction(*dict) << "unknown huge page policy " << policyName << nl
+                                      << "Available policies: none, transparent"
+                                      << exit(FatalIOError);
+    }
+    Info << "Huge page policy " << policyName << " for allocations of at least " << minBytes
+         << " bytes" << endl;
+}
+
+HugePageReport hugePageReport()
+{
+    HugePageReport report;
+    report.advisedBytes = advisedBytes_;
+
+    // the active mode is given in brackets, e.g. always [madvise] never
+    std::ifstream enabled("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string modes;
+    if (std::getline(enabled, modes))
+    {
+        const auto start = modes.find('[');
+        const auto end = modes.find(']');
+        if (start != std::string::npos && end != std::string::npos && end > start)
+        {
+            report.mode = modes.substr(start + 1, end - start - 1);
+        }
+    }
+
+    std::ifstream smaps("/proc/self/smaps_rollup");
+    std::string line;
+    while (std::getline(smaps, line))
+    {
+        if (line.rfind("AnonHugePages:", 0) == 0)
+        {
+            std::istringstream is(line.substr(14));
+            size_t kB = 0;
+            is >> kB;
+            report.anonHugePagesBytes = kB * 1024;
+        }
+    }
+    return report;
+}
+
+Ostream& operator<<(Ostream& os, const HugePageReport& report)
+{
+    constexpr double MB = 1024.0 * 1024.0;
+    os << "Huge pages (mode " << (report.mode.empty() ? word("unavailable") : report.mode)
+       << "): advised " << report.advisedBytes / MB << " MB, granted "
+       << report.anonHugePagesBytes / MB << " MB";
+    return os;
+}
+
+namespace detail
+{
+
+void adviseHugePages(void* ptr, const size_t nBytes)
+{
+#if defined(MADV_HUGEPAGE)
+    if (policy_ != HugePagePolicy::transparent || nBytes < minBytes_)
+    {
+        return;
+    }
+
+    // only whole huge pages inside the allocation can be advised
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    const std::uintptr_t start = (address + hugePageSize - 1) & ~(hugePageSize - 1);
+    const std::uintptr_t end = (address + nBytes) & ~(hugePageSize - 1);
+    if (end > start && madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE) == 0)
+    {
+        advisedBytes_ += end - start;
+    }
+#endif
+}
+
+} // namespace detail
+
+} // namespace Foam
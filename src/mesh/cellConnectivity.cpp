@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/mesh/cellConnectivity.hpp"
+#include "FoamAdapter/parallel/reduce.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+CellConnectivity computeCellConnectivity(const NeoFOAM::UnstructuredMesh& mesh)
+{
+    const NeoFOAM::Executor exec = mesh.exec();
+    const size_t nCells = mesh.nCells();
+    const size_t nInternalFaces = mesh.nInternalFaces();
+    const auto owner = mesh.faceOwner().span();
+    const auto neighbour = mesh.faceNeighbour().span();
+    const auto faceCells = mesh.boundaryMesh().faceCells().span();
+    // the boundary faces are numbered as in the surface fields, i.e. without empty patches
+    const size_t nFaces = nInternalFaces + faceCells.size();
+
+    NeoFOAM::Field<NeoFOAM::label> counts(exec, nCells);
+    NeoFOAM::fill(counts, NeoFOAM::label(0));
+    NeoFOAM::label* count = counts.data();
+    NeoFOAM::parallelFor(
+        exec,
+        {0, nFaces},
+        KOKKOS_LAMBDA(const size_t facei) {
+            if (facei < nInternalFaces)
+            {
+                Kokkos::atomic_add(&count[owner[facei]], 1);
+                Kokkos::atomic_add(&count[neighbour[facei]], 1);
+            }
+            else
+            {
+                Kokkos::atomic_add(&count[faceCells[facei - nInternalFaces]], 1);
+            }
+        }
+    );
+
+    NeoFOAM::Field<NeoFOAM::label> offsets(exec, nCells + 1);
+    NeoFOAM::label* offset = offsets.data();
+    const NeoFOAM::label nEntries = detail::parallelScan(
+        exec,
+        "CellConnectivity::offsets",
+        {0, nCells},
+        KOKKOS_LAMBDA(const size_t celli, NeoFOAM::label& partial, const bool final) {
+            if (final)
+            {
+                offset[celli] = partial;
+            }
+            partial += count[celli];
+        }
+    );
+    NeoFOAM::parallelFor(
+        exec, {nCells, nCells + 1}, KOKKOS_LAMBDA(const size_t i) { offset[i] = nEntries; }
+    );
+
+    // the counts are reused as the insert position within each cell
+    NeoFOAM::Field<NeoFOAM::label> faces(exec, nEntries);
+    NeoFOAM::label* face = faces.data();
+    NeoFOAM::fill(counts, NeoFOAM::label(0));
+    NeoFOAM::parallelFor(
+        exec,
+        {0, nFaces},
+        KOKKOS_LAMBDA(const size_t facei) {
+            const NeoFOAM::label own =
+                facei < nInternalFaces ? owner[facei] : faceCells[facei - nInternalFaces];
+            face[offset[own] + Kokkos::atomic_fetch_add(&count[own], 1)] = facei;
+            if (facei < nInternalFaces)
+            {
+                const NeoFOAM::label nei = neighbour[facei];
+                face[offset[nei] + Kokkos::atomic_fetch_add(&count[nei], 1)] = facei;
+            }
+        }
+    );
+
+    // the insert order depends on the scheduling, sorting the few faces of each cell makes the
+    // connectivity and the gathered sums deterministic
+    NeoFOAM::Field<NeoFOAM::label> cells(exec, nEntries);
+    NeoFOAM::Field<NeoFOAM::scalar> signs(exec, nEntries);
+    NeoFOAM::label* cell = cells.data();
+    NeoFOAM::scalar* sign = signs.data();
+    NeoFOAM::parallelFor(
+        exec,
+        {0, nCells},
+        KOKKOS_LAMBDA(const size_t celli) {
+            const NeoFOAM::label start = offset[celli];
+            const NeoFOAM::label end = offset[celli + 1];
+            for (NeoFOAM::label j = start + 1; j < end; j++)
+            {
+                const NeoFOAM::label facei = face[j];
+                NeoFOAM::label k = j;
+                for (; k > start && face[k - 1] > facei; k--)
+                {
+                    face[k] = face[k - 1];
+                }
+                face[k] = facei;
+            }
+            for (NeoFOAM::label j = start; j < end; j++)
+            {
+                const NeoFOAM::label facei = face[j];
+                if (size_t(facei) >= nInternalFaces)
+                {
+                    sign[j] = 1.0;
+                    cell[j] = -1;
+                }
+                else if (owner[facei] == NeoFOAM::label(celli))
+                {
+                    sign[j] = 1.0;
+                    cell[j] = neighbour[facei];
+                }
+                else
+                {
+                    sign[j] = -1.0;
+                    cell[j] = owner[facei];
+                }
+            }
+        }
+    );
+
+    return {offsets, faces, cells, signs};
+}
+
+void gatherDiv(
+    const CellConnectivity& connectivity,
+    const NeoFOAM::UnstructuredMesh& mesh,
+    const fvcc::SurfaceField<NeoFOAM::scalar>& faceFlux,
+    const fvcc::SurfaceField<NeoFOAM::scalar>& faceValues,
+    fvcc::VolumeField<NeoFOAM::scalar>& divPhi
+)
+{
+    const auto offset = connectivity.offsets.span();
+    const auto face = connectivity.faces.span();
+    const auto sign = connectivity.signs.span();
+    const auto flux = faceFlux.internalField().span();
+    const auto values = faceValues.internalField().span();
+    const auto volume = mesh.cellVolumes().span();
+    auto result = divPhi.internalField().span();
+
+    NeoFOAM::parallelFor(
+        divPhi.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            NeoFOAM::scalar sum = 0.0;
+            for (NeoFOAM::label j = offset[celli]; j < offset[celli + 1]; j++)
+            {
+                sum += sign[j] * flux[face[j]] * values[face[j]];
+            }
+            result[celli] = sum / volume[celli];
+        }
+    );
+}
+
+} // namespace Foam
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/mesh/nonOrthGeometry.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+NonOrthGeometry computeNonOrthGeometry(const NeoFOAM::UnstructuredMesh& mesh)
+{
+    const NeoFOAM::Executor exec = mesh.exec();
+    const size_t nInternalFaces = mesh.nInternalFaces();
+    const size_t nFaces = nInternalFaces + mesh.nBoundaryFaces();
+    const auto owner = mesh.faceOwner().span();
+    const auto neighbour = mesh.faceNeighbour().span();
+    const auto C = mesh.cellCentres().span();
+    const auto Sf = mesh.faceAreas().span();
+    const auto magSf = mesh.magFaceAreas().span();
+    const auto boundaryNf = mesh.boundaryMesh().nf().span();
+    const auto boundaryDelta = mesh.boundaryMesh().delta().span();
+
+    NeoFOAM::Field<NeoFOAM::scalar> deltaCoeffs(exec, nFaces);
+    NeoFOAM::Field<NeoFOAM::Vector> correctionVectors(exec, nFaces);
+    auto coeffs = deltaCoeffs.span();
+    auto corrVecs = correctionVectors.span();
+
+    NeoFOAM::parallelFor(
+        exec,
+        {0, nFaces},
+        KOKKOS_LAMBDA(const size_t facei) {
+            NeoFOAM::Vector n;
+            NeoFOAM::Vector d;
+            if (facei < nInternalFaces)
+            {
+                n = Sf[facei] * (1.0 / magSf[facei]);
+                d = C[neighbour[facei]] - C[owner[facei]];
+            }
+            else
+            {
+                n = boundaryNf[facei - nInternalFaces];
+                d = boundaryDelta[facei - nInternalFaces];
+            }
+            const NeoFOAM::scalar coeff =
+                1.0 / Kokkos::max(n & d, 0.05 * Kokkos::sqrt(d & d));
+            coeffs[facei] = coeff;
+            corrVecs[facei] = n - coeff * d;
+        }
+    );
+
+    return {deltaCoeffs, correctionVectors};
+}
+
+NeoFOAM::Field<NeoFOAM::scalar> computeLinearWeights(const NeoFOAM::UnstructuredMesh& mesh)
+{
+    const size_t nInternalFaces = mesh.nInternalFaces();
+    NeoFOAM::Field<NeoFOAM::scalar> weights(mesh.exec(), nInternalFaces);
+
+    const auto owner = mesh.faceOwner().span();
+    const auto neighbour = mesh.faceNeighbour().span();
+    const auto C = mesh.cellCentres().span();
+    const auto Cf = mesh.faceCentres().span();
+    const auto Sf = mesh.faceAreas().span();
+    auto w = weights.span();
+
+    NeoFOAM::parallelFor(
+        mesh.exec(),
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const size_t facei) {
+            const NeoFOAM::scalar sfdOwn = Kokkos::abs(Sf[facei] & (Cf[facei] - C[owner[facei]]));
+            const NeoFOAM::scalar sfdNei =
+                Kokkos::abs(Sf[facei] & (C[neighbour[facei]] - Cf[facei]));
+            w[facei] = sfdNei / (sfdOwn + sfdNei);
+        }
+    );
+    return weights;
+}
+
+} // namespace Foam
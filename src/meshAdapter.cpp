@@ -2,6 +2,7 @@
 // SPDX-FileCopyrightText: 2023 NeoFOAM authors
 
 #include "FoamAdapter/meshAdapter.hpp"
+#include "FoamAdapter/setup/meshConversion.hpp"
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
@@ -58,6 +59,11 @@ int32_t computeNBoundaryFaces(const fvMesh& mesh)
 
 NeoFOAM::UnstructuredMesh readOpenFOAMMesh(const NeoFOAM::Executor exec, const fvMesh& mesh)
 {
+    if (meshConversionChunkSize() > 0)
+    {
+        return readOpenFOAMMeshChunked(exec, mesh, meshConversionChunkSize());
+    }
+
     const int32_t nCells = mesh.nCells();
     const int32_t nInternalFaces = mesh.nInternalFaces();
     const int32_t nBoundaryFaces = computeNBoundaryFaces(mesh);
@@ -127,21 +133,77 @@ NeoFOAM::UnstructuredMesh readOpenFOAMMesh(const NeoFOAM::Executor exec, const f
     return uMesh;
 }
 
+namespace
+{
+
+// 64 bit FNV-1a hash
+void hashBytes(uint64_t& hash, const void* data, const size_t nBytes)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < nBytes; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+}
+
+template<typename ListType>
+void hashList(uint64_t& hash, const ListType& list)
+{
+    const label size = list.size();
+    hashBytes(hash, &size, sizeof(label));
+    hashBytes(hash, list.cdata(), list.size_bytes());
+}
+
+}
+
+uint64_t computeMeshHash(const polyMesh& mesh)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    hashList(hash, mesh.points());
+    for (const face& f : mesh.faces())
+    {
+        hashList(hash, f);
+    }
+    hashList(hash, mesh.faceOwner());
+    hashList(hash, mesh.faceNeighbour());
+    const polyBoundaryMesh& bMesh = mesh.boundaryMesh();
+    forAll(bMesh, patchi)
+    {
+        const label start = bMesh[patchi].start();
+        const label size = bMesh[patchi].size();
+        hashBytes(hash, &start, sizeof(label));
+        hashBytes(hash, &size, sizeof(label));
+    }
+    return hash;
+}
+
 MeshAdapter::MeshAdapter(const NeoFOAM::Executor exec, const IOobject& io, const bool doInit)
     : fvMesh(io, doInit)
     , nfMesh_(readOpenFOAMMesh(exec, *this))
+    , nonOrthGeometry_(computeNonOrthGeometry(nfMesh_))
 {
     if (doInit)
     {
         init(false); // do not initialise lower levels
     }
+    if (releaseFoamStorage())
+    {
+        clearFoamStorage();
+    }
 }
 
 
 MeshAdapter::MeshAdapter(const NeoFOAM::Executor exec, const IOobject& io, const zero, bool syncPar)
     : fvMesh(io, zero {}, syncPar)
     , nfMesh_(readOpenFOAMMesh(exec, *this))
-{}
+    , nonOrthGeometry_(computeNonOrthGeometry(nfMesh_))
+{
+    if (releaseFoamStorage())
+    {
+        clearFoamStorage();
+    }
+}
 
 
 MeshAdapter::MeshAdapter(
@@ -162,7 +224,13 @@ MeshAdapter::MeshAdapter(
         syncPar
     )
     , nfMesh_(readOpenFOAMMesh(exec, *this))
-{}
+    , nonOrthGeometry_(computeNonOrthGeometry(nfMesh_))
+{
+    if (releaseFoamStorage())
+    {
+        clearFoamStorage();
+    }
+}
 
 
 MeshAdapter::MeshAdapter(
@@ -175,6 +243,57 @@ MeshAdapter::MeshAdapter(
 )
     : fvMesh(io, std::move(points), std::move(faces), std::move(cells), syncPar)
     , nfMesh_(readOpenFOAMMesh(exec, *this))
-{}
+    , nonOrthGeometry_(computeNonOrthGeometry(nfMesh_))
+{
+    if (releaseFoamStorage())
+    {
+        clearFoamStorage();
+    }
+}
+
+
+const CellConnectivity& MeshAdapter::cellConnectivity() const
+{
+    if (!cellConnectivity_)
+    {
+        cellConnectivity_ = std::make_unique<CellConnectivity>(computeCellConnectivity(nfMesh_));
+    }
+    return *cellConnectivity_;
+}
+
+void MeshAdapter::clearFoamStorage()
+{
+    // points, faces and owner/neighbour are the primary data of the polyMesh and are kept
+    clearOut();
+}
+
+size_t MeshAdapter::foamGeometryBytes() const
+{
+    size_t bytes = 0;
+    if (hasCellCentres())
+    {
+        bytes += cellCentres().size_bytes();
+    }
+    if (hasFaceCentres())
+    {
+        bytes += faceCentres().size_bytes();
+    }
+    if (hasFaceAreas())
+    {
+        bytes += faceAreas().size_bytes();
+    }
+    if (hasCellVolumes())
+    {
+        bytes += cellVolumes().size_bytes();
+    }
+    if (hasCells())
+    {
+        for (const cell& c : cells())
+        {
+            bytes += c.size_bytes();
+        }
+    }
+    return bytes;
+}
 
 }
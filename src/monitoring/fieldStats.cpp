@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/monitoring/fieldStats.hpp"
+#include "FoamAdapter/parallel/reduce.hpp"
+
+#include "NeoFOAM/core/error.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+KOKKOS_INLINE_FUNCTION
+NeoFOAM::scalar magnitude(const NeoFOAM::scalar& value) { return value; }
+
+KOKKOS_INLINE_FUNCTION
+NeoFOAM::scalar magnitude(const NeoFOAM::Vector& value) { return NeoFOAM::mag(value); }
+
+template<typename ValueType>
+labelField histogram(
+    const NeoFOAM::Executor& exec,
+    std::span<const ValueType> values,
+    const label nBins,
+    const scalar lower,
+    const scalar upper
+)
+{
+    NeoFOAM::Field<NeoFOAM::label> bins(exec, nBins);
+    NeoFOAM::fill(bins, NeoFOAM::label(0));
+    NeoFOAM::label* counts = bins.data();
+    const scalar scale = upper > lower ? nBins / (upper - lower) : 0;
+    NeoFOAM::parallelFor(
+        exec,
+        {0, values.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            // clamp before the conversion, which is undefined for NaN and out of range values
+            const NeoFOAM::scalar position = (magnitude(values[i]) - lower) * scale;
+            const NeoFOAM::scalar clamped =
+                position >= 0 ? Kokkos::fmin(position, NeoFOAM::scalar(nBins - 1)) : 0;
+            Kokkos::atomic_add(&counts[static_cast<NeoFOAM::label>(clamped)], 1);
+        }
+    );
+
+    auto hostBins = bins.copyToHost();
+    labelField result(nBins);
+    forAll(result, bini)
+    {
+        result[bini] = hostBins.span()[bini];
+    }
+    return result;
+}
+
+}
+
+template<typename ValueType>
+FieldStats computeFieldStats(
+    const NeoFOAM::Executor& exec,
+    std::span<const ValueType> values,
+    std::span<const NeoFOAM::scalar> volumes,
+    const HistogramBins& bins
+)
+{
+    NF_ASSERT_EQUAL(values.size(), volumes.size());
+
+    NeoFOAM::scalar minValue = GREAT;
+    NeoFOAM::scalar maxValue = -GREAT;
+    NeoFOAM::scalar sum = 0.0;
+    NeoFOAM::scalar weightedSum = 0.0;
+    NeoFOAM::scalar volume = 0.0;
+
+    if (!values.empty())
+    {
+        detail::parallelReduce(
+            exec,
+            "computeFieldStats",
+            {0, values.size()},
+            KOKKOS_LAMBDA(
+                const size_t i,
+                NeoFOAM::scalar& lmin,
+                NeoFOAM::scalar& lmax,
+                NeoFOAM::scalar& lsum,
+                NeoFOAM::scalar& lweighted,
+                NeoFOAM::scalar& lvolume
+            ) {
+                const NeoFOAM::scalar value = magnitude(values[i]);
+                lmin = Kokkos::fmin(lmin, value);
+                lmax = Kokkos::fmax(lmax, value);
+                lsum += value;
+                lweighted += value * volumes[i];
+                lvolume += volumes[i];
+            },
+            Kokkos::Min<NeoFOAM::scalar>(minValue),
+            Kokkos::Max<NeoFOAM::scalar>(maxValue),
+            Kokkos::Sum<NeoFOAM::scalar>(sum),
+            Kokkos::Sum<NeoFOAM::scalar>(weightedSum),
+            Kokkos::Sum<NeoFOAM::scalar>(volume)
+        );
+    }
+
+    FieldStats stats;
+    stats.min = returnReduce(minValue, minOp<scalar>());
+    stats.max = returnReduce(maxValue, maxOp<scalar>());
+    stats.sum = returnReduce(sum, sumOp<scalar>());
+    stats.volume = returnReduce(volume, sumOp<scalar>());
+    stats.mean = returnReduce(weightedSum, sumOp<scalar>()) / max(stats.volume, VSMALL);
+    stats.size = returnReduce(label(values.size()), sumOp<label>());
+
+    if (bins.nBins > 0)
+    {
+        const bool fieldRange = bins.min >= bins.max;
+        stats.histogramMin = fieldRange ? stats.min : bins.min;
+        stats.histogramMax = fieldRange ? stats.max : bins.max;
+        stats.histogram =
+            histogram(exec, values, bins.nBins, stats.histogramMin, stats.histogramMax);
+        reduce(stats.histogram, sumOp<labelField>());
+    }
+    return stats;
+}
+
+template FieldStats computeFieldStats<NeoFOAM::scalar>(
+    const NeoFOAM::Executor&,
+    std::span<const NeoFOAM::scalar>,
+    std::span<const NeoFOAM::scalar>,
+    const HistogramBins&
+);
+
+template FieldStats computeFieldStats<NeoFOAM::Vector>(
+    const NeoFOAM::Executor&,
+    std::span<const NeoFOAM::Vector>,
+    std::span<const NeoFOAM::scalar>,
+    const HistogramBins&
+);
+
+Ostream& operator<<(Ostream& os, const FieldStats& stats)
+{
+    os << stats.name << ": min " << stats.min << " max " << stats.max << " sum " << stats.sum
+       << " mean " << stats.mean << nl;
+    if (stats.histogram.size())
+    {
+        const scalar width = (stats.histogramMax - stats.histogramMin) / stats.histogram.size();
+        forAll(stats.histogram, bini)
+        {
+            os << "    [" << stats.histogramMin + bini * width << ", "
+               << stats.histogramMin + (bini + 1) * width << "): " << stats.histogram[bini] << nl;
+        }
+    }
+    return os;
+}
+
+} // namespace Foam
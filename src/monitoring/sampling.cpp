@@ -0,0 +1,405 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "IOmanip.H"
+#include "OSspecific.H"
+#include "OStringStream.H"
+
+#include "FoamAdapter/monitoring/sampling.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+// points of this processor, a point found on several processors is sampled by the lowest
+labelList ownedPoints(const word& name, const MeshAdapter& mesh, const pointField& points)
+{
+    labelField owner(points.size(), labelMax);
+    forAll(points, pointi)
+    {
+        if (mesh.findCell(points[pointi]) >= 0)
+        {
+            owner[pointi] = Pstream::myProcNo();
+        }
+    }
+    reduce(owner, minOp<labelField>());
+
+    DynamicList<label> local;
+    forAll(points, pointi)
+    {
+        if (owner[pointi] == labelMax)
+        {
+            WarningInFunction << "point " << points[pointi] << " of " << name
+                              << " is outside the mesh" << endl;
+        }
+        else if (owner[pointi] == Pstream::myProcNo())
+        {
+            local.append(pointi);
+        }
+    }
+    return labelList(std::move(local));
+}
+
+SampleStencil buildStencil(
+    const MeshAdapter& mesh,
+    const pointField& points,
+    const labelList& localPoints,
+    const SampleSet::Interpolation interpolation
+)
+{
+    std::vector<NeoFOAM::label> offsets {0};
+    std::vector<NeoFOAM::label> cells;
+    std::vector<NeoFOAM::scalar> weights;
+
+    const volVectorField& C = mesh.C();
+    for (const label pointi : localPoints)
+    {
+        const point& p = points[pointi];
+        const label celli = mesh.findCell(p);
+        const scalar dist = mag(p - C[celli]);
+
+        if (interpolation == SampleSet::Interpolation::cell || dist < SMALL)
+        {
+            cells.push_back(celli);
+            weights.push_back(1.0);
+        }
+        else
+        {
+            labelList stencil(1, celli);
+            stencil.append(mesh.cellCells()[celli]);
+            scalar sumWeights = 0;
+            for (const label stencilCell : stencil)
+            {
+                sumWeights += 1.0 / max(mag(p - C[stencilCell]), SMALL);
+            }
+            for (const label stencilCell : stencil)
+            {
+                cells.push_back(stencilCell);
+                weights.push_back(1.0 / max(mag(p - C[stencilCell]), SMALL) / sumWeights);
+            }
+        }
+        offsets.push_back(cells.size());
+    }
+
+    const NeoFOAM::Executor exec = mesh.exec();
+    return SampleStencil {
+        NeoFOAM::Field<NeoFOAM::label>(exec, offsets.data(), offsets.size()),
+        NeoFOAM::Field<NeoFOAM::label>(exec, cells.data(), cells.size()),
+        NeoFOAM::Field<NeoFOAM::scalar>(exec, weights.data(), weights.size())
+    };
+}
+
+template<typename ValueType>
+void gatherStencil(
+    const NeoFOAM::Executor& exec,
+    const SampleStencil& stencil,
+    std::span<const ValueType> cellValues,
+    std::span<ValueType> values
+)
+{
+    const auto offsets = stencil.offsets.span();
+    const auto cells = stencil.cells.span();
+    const auto weights = stencil.weights.span();
+    NeoFOAM::parallelFor(
+        exec,
+        {0, values.size()},
+        KOKKOS_LAMBDA(const size_t samplei) {
+            ValueType value {};
+            for (NeoFOAM::label j = offsets[samplei]; j < offsets[samplei + 1]; j++)
+            {
+                value += weights[j] * cellValues[cells[j]];
+            }
+            values[samplei] = value;
+        }
+    );
+}
+
+std::ostream& writeValue(std::ostream& os, const NeoFOAM::scalar& value)
+{
+    return os << ' ' << value;
+}
+
+std::ostream& writeValue(std::ostream& os, const NeoFOAM::Vector& value)
+{
+    return os << " (" << value[0] << ' ' << value[1] << ' ' << value[2] << ')';
+}
+
+pointField samplePoints(const word& name, const dictionary& dict)
+{
+    const word type = dict.get<word>("type");
+    if (type == "probes")
+    {
+        return dict.get<pointField>("points");
+    }
+    if (type == "line")
+    {
+        const point start = dict.get<point>("start");
+        const point end = dict.get<point>("end");
+        const label nPoints = dict.get<label>("nPoints");
+        pointField points(nPoints);
+        forAll(points, pointi)
+        {
+            points[pointi] = start + (end - start) * pointi / max(nPoints - 1, 1);
+        }
+        return points;
+    }
+    if (type == "plane")
+    {
+        const point origin = dict.get<point>("origin");
+        const vector e1 = dict.get<vector>("e1");
+        const vector e2 = dict.get<vector>("e2");
+        const labelList nPoints = dict.get<labelList>("nPoints");
+        if (nPoints.size() != 2)
+        {
+            FatalIOErrorInFunction(dict) << "nPoints of sample set " << name
+                                         << " needs two entries" << exit(FatalIOError);
+        }
+        pointField points(nPoints[0] * nPoints[1]);
+        for (label j = 0; j < nPoints[1]; j++)
+        {
+            for (label i = 0; i < nPoints[0]; i++)
+            {
+                // cell centred in the plane so the points stay off the domain boundary
+                points[j * nPoints[0] + i] =
+                    origin + e1 * (i + 0.5) / nPoints[0] + e2 * (j + 0.5) / nPoints[1];
+            }
+        }
+        return points;
+    }
+
+    FatalIOErrorInFunction(dict) << "unknown type " << type << " of sample set " << name
+                                 << ", valid types are probes, line and plane"
+                                 << exit(FatalIOError);
+    return pointField();
+}
+
+}
+
+SampleSet::SampleSet(
+    const word& name,
+    const MeshAdapter& mesh,
+    const pointField& points,
+    const Interpolation interpolation
+)
+    : name_(name)
+    , points_(points)
+    , localPoints_(ownedPoints(name, mesh, points))
+    , stencil_(buildStencil(mesh, points_, localPoints_, interpolation))
+{}
+
+std::unique_ptr<SampleSet>
+SampleSet::New(const word& name, const MeshAdapter& mesh, const dictionary& dict)
+{
+    const word interpolation = dict.getOrDefault<word>("interpolation", "cell");
+    if (interpolation != "cell" && interpolation != "inverseDistance")
+    {
+        FatalIOErrorInFunction(dict) << "unknown interpolation " << interpolation
+                                     << ", valid interpolations are cell and inverseDistance"
+                                     << exit(FatalIOError);
+    }
+    return std::make_unique<SampleSet>(
+        name,
+        mesh,
+        samplePoints(name, dict),
+        interpolation == "cell" ? Interpolation::cell : Interpolation::inverseDistance
+    );
+}
+
+template<typename ValueType>
+NeoFOAM::Field<ValueType> SampleSet::gather(const NeoFOAM::Field<ValueType>& cellValues) const
+{
+    NeoFOAM::Field<ValueType> values(cellValues.exec(), localPoints_.size());
+    gatherStencil<ValueType>(cellValues.exec(), stencil_, cellValues.span(), values.span());
+    return values;
+}
+
+template<typename ValueType>
+std::vector<ValueType> SampleSet::sample(const fvcc::VolumeField<ValueType>& field) const
+{
+    constexpr label nComponents = sizeof(ValueType) / sizeof(NeoFOAM::scalar);
+
+    // each point is sampled by one processor, the others contribute zeros
+    scalarField flat(points_.size() * nComponents, 0);
+    if (localPoints_.size())
+    {
+        auto hostValues = gather(field.internalField()).copyToHost();
+        const auto values = hostValues.span();
+        forAll(localPoints_, samplei)
+        {
+            std::memcpy(
+                &flat[localPoints_[samplei] * nComponents], &values[samplei], sizeof(ValueType)
+            );
+        }
+    }
+    reduce(flat, sumOp<scalarField>());
+
+    std::vector<ValueType> result(points_.size());
+    std::memcpy(result.data(), flat.cdata(), flat.size() * sizeof(NeoFOAM::scalar));
+    return result;
+}
+
+template NeoFOAM::Field<NeoFOAM::scalar>
+SampleSet::gather<NeoFOAM::scalar>(const NeoFOAM::Field<NeoFOAM::scalar>&) const;
+
+template NeoFOAM::Field<NeoFOAM::Vector>
+SampleSet::gather<NeoFOAM::Vector>(const NeoFOAM::Field<NeoFOAM::Vector>&) const;
+
+template std::vector<NeoFOAM::scalar>
+SampleSet::sample<NeoFOAM::scalar>(const fvcc::VolumeField<NeoFOAM::scalar>&) const;
+
+template std::vector<NeoFOAM::Vector>
+SampleSet::sample<NeoFOAM::Vector>(const fvcc::VolumeField<NeoFOAM::Vector>&) const;
+
+
+void SampleWriter::State::flush()
+{
+    std::lock_guard<std::mutex> writeLock(writeMutex);
+    std::string pending;
+    {
+        std::lock_guard<std::mutex> rowsLock(rowsMutex);
+        pending.swap(rows);
+    }
+    os.write(pending.data(), pending.size());
+    os.flush();
+    if (!os)
+    {
+        failed = true;
+    }
+}
+
+SampleWriter::SampleWriter(const fileName& file, const pointField& points, WorkStealingPool* pool)
+    : file_(file), state_(), pool_(pool)
+{
+    mkDir(file.path());
+    state_ = std::make_shared<State>(file);
+
+    OStringStream os;
+    forAll(points, pointi)
+    {
+        os << "# Probe " << pointi << ' ' << points[pointi] << nl;
+    }
+    os << '#' << setw(IOstream::defaultPrecision() + 6) << "Time";
+    forAll(points, pointi)
+    {
+        os << ' ' << setw(IOstream::defaultPrecision() + 6) << pointi;
+    }
+    os << nl;
+    state_->rows = os.str();
+    state_->flush();
+    checkState();
+}
+
+SampleWriter::~SampleWriter()
+{
+    state_->flush();
+}
+
+void SampleWriter::checkState() const
+{
+    if (state_->failed)
+    {
+        FatalErrorInFunction << "writing the samples to " << file_ << " failed"
+                             << exit(FatalError);
+    }
+}
+
+void SampleWriter::append(const scalar time, std::string row)
+{
+    checkState();
+
+    std::ostringstream line;
+    line << std::setprecision(IOstream::defaultPrecision()) << time << row << '\n';
+    {
+        std::lock_guard<std::mutex> rowsLock(state_->rowsMutex);
+        state_->rows += line.str();
+    }
+    if (pool_)
+    {
+        pool_->submit([state = state_]() { state->flush(); });
+    }
+    else
+    {
+        state_->flush();
+        checkState();
+    }
+}
+
+void SampleWriter::flush()
+{
+    state_->flush();
+    checkState();
+}
+
+
+Samplers::Samplers(const MeshAdapter& mesh, const dictionary& dict, WorkStealingPool* pool)
+    : mesh_(mesh), pool_(pool), sets_(), fields_(), writers_()
+{
+    const dictionary samplingDict = dict.subOrEmptyDict("sampling");
+    for (const word& name : samplingDict.toc())
+    {
+        const dictionary& setDict = samplingDict.subDict(name);
+        sets_.push_back(SampleSet::New(name, mesh, setDict));
+        fields_.push_back(setDict.get<wordList>("fields"));
+    }
+
+    // the files are opened under the start time, only the master writes
+    if (Pstream::master())
+    {
+        const Time& time = mesh_.time();
+        for (size_t seti = 0; seti < sets_.size(); seti++)
+        {
+            const SampleSet& set = *sets_[seti];
+            for (const word& fieldName : fields_[seti])
+            {
+                writers_[{set.name(), fieldName}] = std::make_unique<SampleWriter>(
+                    time.globalPath() / "postProcessing" / set.name() / time.timeName()
+                        / fieldName,
+                    set.points(),
+                    pool_
+                );
+            }
+        }
+    }
+}
+
+SampleWriter& Samplers::writer(const SampleSet& set, const word& fieldName)
+{
+    return *writers_.at({set.name(), fieldName});
+}
+
+template<typename ValueType>
+void Samplers::write(const fvcc::VolumeField<ValueType>& field)
+{
+    for (size_t seti = 0; seti < sets_.size(); seti++)
+    {
+        if (!fields_[seti].found(field.name))
+        {
+            continue;
+        }
+        const auto values = sets_[seti]->sample(field);
+        if (Pstream::master())
+        {
+            std::ostringstream row;
+            row << std::setprecision(IOstream::defaultPrecision());
+            for (const auto& value : values)
+            {
+                writeValue(row, value);
+            }
+            writer(*sets_[seti], field.name).append(mesh_.time().value(), row.str());
+        }
+    }
+}
+
+template void Samplers::write<NeoFOAM::scalar>(const fvcc::VolumeField<NeoFOAM::scalar>&);
+
+template void Samplers::write<NeoFOAM::Vector>(const fvcc::VolumeField<NeoFOAM::Vector>&);
+
+} // namespace Foam
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/operators/convection.hpp"
+#include "FoamAdapter/mesh/nonOrthGeometry.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+// true for Gauss upwind, false for Gauss linear
+bool isUpwind(const NeoFOAM::TokenList& scheme)
+{
+    if (scheme.size() == 2 && scheme.get<std::string>(0) == "Gauss")
+    {
+        const std::string interpolation = scheme.get<std::string>(1);
+        if (interpolation == "upwind" || interpolation == "linear")
+        {
+            return interpolation == "upwind";
+        }
+    }
+    FatalErrorInFunction << "unsupported implicit convection scheme, valid schemes are "
+                         << "Gauss upwind and Gauss linear" << exit(FatalError);
+    return false;
+}
+
+}
+
+Convection::Convection(const MeshAdapter& mesh, const NeoFOAM::TokenList& scheme)
+    : mesh_(mesh), upwind_(isUpwind(scheme)), linearWeights_(computeLinearWeights(mesh.nfMesh()))
+{}
+
+void Convection::assemble(
+    const fvcc::SurfaceField<NeoFOAM::scalar>& faceFlux,
+    const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+    LduSystem& system
+) const
+{
+    const CellConnectivity& connectivity = mesh_.cellConnectivity();
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh_.nfMesh();
+    const NeoFOAM::label nInternalFaces = nfMesh.nInternalFaces();
+    const bool upwind = upwind_;
+    const auto offsets = connectivity.offsets.span();
+    const auto faces = connectivity.faces.span();
+    const auto cells = connectivity.cells.span();
+    const auto signs = connectivity.signs.span();
+    const auto weights = linearWeights_.span();
+    const auto boundaryDeltaCoeffs = nfMesh.boundaryMesh().deltaCoeffs().span();
+    const auto flux = faceFlux.internalField().span();
+    const auto valueFraction = phi.boundaryField().valueFraction().span();
+    const auto refValue = phi.boundaryField().refValue().span();
+    const auto refGrad = phi.boundaryField().refGrad().span();
+    auto lower = system.lower.span();
+    auto upper = system.upper.span();
+    auto diag = system.diag.span();
+    auto source = system.source.span();
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, upper.size()},
+        KOKKOS_LAMBDA(const size_t facei) {
+            const NeoFOAM::scalar w = upwind ? (flux[facei] >= 0 ? 1.0 : 0.0) : weights[facei];
+            lower[facei] -= w * flux[facei];
+            upper[facei] += (1.0 - w) * flux[facei];
+        }
+    );
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, diag.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            NeoFOAM::scalar diagSum = 0.0;
+            NeoFOAM::scalar sourceSum = 0.0;
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                const NeoFOAM::label facei = faces[j];
+                const NeoFOAM::scalar F = flux[facei];
+                if (cells[j] >= 0)
+                {
+                    const NeoFOAM::scalar w = upwind ? (F >= 0 ? 1.0 : 0.0) : weights[facei];
+                    // the owner row loses lower, the neighbour row loses upper
+                    diagSum += signs[j] > 0 ? w * F : -(1.0 - w) * F;
+                }
+                else
+                {
+                    // valueInternalCoeffs and valueBoundaryCoeffs of a mixed condition
+                    const NeoFOAM::label bfacei = facei - nInternalFaces;
+                    const NeoFOAM::scalar f = valueFraction[bfacei];
+                    diagSum += F * (1.0 - f);
+                    sourceSum -= F
+                               * (f * refValue[bfacei]
+                                  + (1.0 - f) * refGrad[bfacei] / boundaryDeltaCoeffs[bfacei]);
+                }
+            }
+            diag[celli] += diagSum;
+            source[celli] += sourceSum;
+        }
+    );
+}
+
+} // namespace Foam
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/operators/gradScheme.hpp"
+#include "FoamAdapter/operators/leastSquaresGrad.hpp"
+#include "FoamAdapter/operators/limitedGrad.hpp"
+#include "FoamAdapter/conversion/convert.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+// selects the scheme of the tokens [first, last)
+std::unique_ptr<GradScheme> select(
+    const MeshAdapter& mesh,
+    const NeoFOAM::TokenList& scheme,
+    const size_t first,
+    const size_t last
+)
+{
+    if (first >= last)
+    {
+        FatalErrorInFunction << "missing gradient scheme" << exit(FatalError);
+    }
+
+    const std::string type = scheme.get<std::string>(first);
+    if (type == "Gauss")
+    {
+        if (last - first != 2 || scheme.get<std::string>(first + 1) != "linear")
+        {
+            FatalErrorInFunction << "only Gauss linear is supported" << exit(FatalError);
+        }
+        return std::make_unique<GaussGrad>(mesh);
+    }
+    if (type == "leastSquares")
+    {
+        return std::make_unique<LeastSquaresGrad>(mesh);
+    }
+    if (type == "cellLimited" || type == "faceLimited")
+    {
+        const scalar k = getScalar(scheme, last - 1);
+        if (k < 0 || k > 1)
+        {
+            FatalErrorInFunction << "coefficient = " << k << " should be >= 0 and <= 1"
+                                 << exit(FatalError);
+        }
+        auto basicGrad = select(mesh, scheme, first + 1, last - 1);
+        if (type == "cellLimited")
+        {
+            return std::make_unique<CellLimitedGrad>(mesh, std::move(basicGrad), k);
+        }
+        return std::make_unique<FaceLimitedGrad>(mesh, std::move(basicGrad), k);
+    }
+
+    FatalErrorInFunction << "unknown gradient scheme " << type << nl
+                         << "available schemes: Gauss linear, leastSquares, cellLimited and "
+                         << "faceLimited"
+                         << exit(FatalError);
+    return nullptr;
+}
+
+}
+
+std::unique_ptr<GradScheme>
+GradScheme::New(const MeshAdapter& mesh, const NeoFOAM::TokenList& scheme)
+{
+    return select(mesh, scheme, 0, scheme.size());
+}
+
+std::unique_ptr<GradScheme> GradScheme::New(const MeshAdapter& mesh, const word& name)
+{
+    return New(mesh, convert(mesh.gradScheme(name)));
+}
+
+fvcc::VolumeField<NeoFOAM::Vector>
+gradientField(const NeoFOAM::Executor& exec, const NeoFOAM::UnstructuredMesh& mesh)
+{
+    std::vector<fvcc::VolumeBoundary<NeoFOAM::Vector>> bcs;
+    for (size_t patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+    {
+        NeoFOAM::Dictionary patchDict;
+        patchDict.insert("type", std::string("calculated"));
+        bcs.emplace_back(mesh, patchDict, patchi);
+    }
+    return fvcc::VolumeField<NeoFOAM::Vector>(exec, "gradient", mesh, bcs);
+}
+
+GaussGrad::GaussGrad(const MeshAdapter& mesh) : grad_(mesh.exec(), mesh.nfMesh()) {}
+
+void GaussGrad::grad(
+    const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+    fvcc::VolumeField<NeoFOAM::Vector>& gradPhi
+) const
+{
+    NeoFOAM::fill(gradPhi.internalField(), NeoFOAM::Vector(0.0, 0.0, 0.0));
+    grad_.grad(phi, gradPhi);
+}
+
+} // namespace Foam
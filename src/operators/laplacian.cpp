@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/operators/laplacian.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+// the snGrad scheme of a laplacianSchemes entry Gauss <interpolation> <snGrad>
+NeoFOAM::TokenList snGradScheme(const NeoFOAM::TokenList& scheme)
+{
+    if (scheme.size() != 3 || scheme.get<std::string>(0) != "Gauss")
+    {
+        FatalErrorInFunction << "unsupported laplacian scheme, expected Gauss <interpolation> "
+                             << "<snGrad>" << exit(FatalError);
+    }
+    return NeoFOAM::TokenList({scheme.get<std::string>(2)});
+}
+
+}
+
+SnGrad::SnGrad(const MeshAdapter& mesh, const NeoFOAM::TokenList& scheme)
+    : mesh_(mesh)
+    , corrected_(scheme.get<std::string>(0) == "corrected")
+    , gradient_(gradientField(mesh.exec(), mesh.nfMesh()))
+{
+    const std::string type = scheme.get<std::string>(0);
+    if (type != "corrected" && type != "uncorrected")
+    {
+        FatalErrorInFunction << "unknown snGrad scheme " << type
+                             << ", valid schemes are corrected and uncorrected"
+                             << exit(FatalError);
+    }
+}
+
+void SnGrad::correction(
+    const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+    NeoFOAM::Field<NeoFOAM::scalar>& faceCorrection
+) const
+{
+    if (!corrected_)
+    {
+        NeoFOAM::fill(faceCorrection, 0.0);
+        return;
+    }
+
+    std::unique_ptr<GradScheme>& gradScheme = gradSchemes_[phi.name];
+    if (!gradScheme)
+    {
+        gradScheme = GradScheme::New(mesh_, word("grad(" + phi.name + ")"));
+    }
+    gradScheme->grad(phi, gradient_);
+
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh_.nfMesh();
+    const size_t nInternalFaces = nfMesh.nInternalFaces();
+    const auto owner = nfMesh.faceOwner().span();
+    const auto neighbour = nfMesh.faceNeighbour().span();
+    const auto C = nfMesh.cellCentres().span();
+    const auto Cf = nfMesh.faceCentres().span();
+    const auto Sf = nfMesh.faceAreas().span();
+    const auto corrVecs = mesh_.nonOrthGeometry().correctionVectors.span();
+    const auto gradPhi = gradient_.internalField().span();
+    auto result = faceCorrection.span();
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t facei) {
+            if (facei >= nInternalFaces)
+            {
+                result[facei] = 0.0;
+                return;
+            }
+            // linear interpolation of the cell gradient
+            const NeoFOAM::label own = owner[facei];
+            const NeoFOAM::label nei = neighbour[facei];
+            const NeoFOAM::scalar sfdOwn = Kokkos::abs(Sf[facei] & (Cf[facei] - C[own]));
+            const NeoFOAM::scalar sfdNei = Kokkos::abs(Sf[facei] & (C[nei] - Cf[facei]));
+            const NeoFOAM::scalar w = sfdNei / (sfdOwn + sfdNei);
+            result[facei] = corrVecs[facei] & (w * gradPhi[own] + (1.0 - w) * gradPhi[nei]);
+        }
+    );
+}
+
+void SnGrad::snGrad(
+    const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+    fvcc::SurfaceField<NeoFOAM::scalar>& snGradPhi
+) const
+{
+    correction(phi, snGradPhi.internalField());
+
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh_.nfMesh();
+    const size_t nInternalFaces = nfMesh.nInternalFaces();
+    const auto owner = nfMesh.faceOwner().span();
+    const auto neighbour = nfMesh.faceNeighbour().span();
+    const auto faceCells = nfMesh.boundaryMesh().faceCells().span();
+    const auto deltaCoeffs = mesh_.nonOrthGeometry().deltaCoeffs.span();
+    const auto cellValues = phi.internalField().span();
+    const auto boundaryValues = phi.boundaryField().value().span();
+    auto result = snGradPhi.internalField().span();
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t facei) {
+            if (facei < nInternalFaces)
+            {
+                result[facei] +=
+                    deltaCoeffs[facei]
+                    * (cellValues[neighbour[facei]] - cellValues[owner[facei]]);
+            }
+            else
+            {
+                const size_t bfacei = facei - nInternalFaces;
+                result[facei] =
+                    deltaCoeffs[facei] * (boundaryValues[bfacei] - cellValues[faceCells[bfacei]]);
+            }
+        }
+    );
+}
+
+Laplacian::Laplacian(const MeshAdapter& mesh, const NeoFOAM::TokenList& scheme)
+    : mesh_(mesh)
+    , snGrad_(mesh, snGradScheme(scheme))
+    , faceCorrection_(
+          mesh.exec(), mesh.nfMesh().nInternalFaces() + mesh.nfMesh().nBoundaryFaces()
+      )
+{}
+
+void Laplacian::laplacian(
+    const fvcc::SurfaceField<NeoFOAM::scalar>& gamma,
+    const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+    fvcc::VolumeField<NeoFOAM::scalar>& lapPhi
+) const
+{
+    snGrad_.correction(phi, faceCorrection_);
+
+    const CellConnectivity& connectivity = mesh_.cellConnectivity();
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh_.nfMesh();
+    const NeoFOAM::label nInternalFaces = nfMesh.nInternalFaces();
+    const auto offsets = connectivity.offsets.span();
+    const auto faces = connectivity.faces.span();
+    const auto cells = connectivity.cells.span();
+    const auto signs = connectivity.signs.span();
+    const auto magSf = nfMesh.magFaceAreas().span();
+    const auto boundaryMagSf = nfMesh.boundaryMesh().magSf().span();
+    const auto volume = nfMesh.cellVolumes().span();
+    const auto deltaCoeffs = mesh_.nonOrthGeometry().deltaCoeffs.span();
+    const auto corrections = faceCorrection_.span();
+    const auto gammaf = gamma.internalField().span();
+    const auto cellValues = phi.internalField().span();
+    const auto boundaryValues = phi.boundaryField().value().span();
+    auto result = lapPhi.internalField().span();
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            const NeoFOAM::scalar phiP = cellValues[celli];
+            NeoFOAM::scalar sum = 0.0;
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                const NeoFOAM::label facei = faces[j];
+                const bool internal = cells[j] >= 0;
+                const NeoFOAM::scalar gammaMagSf =
+                    gammaf[facei]
+                    * (internal ? magSf[facei] : boundaryMagSf[facei - nInternalFaces]);
+                const NeoFOAM::scalar phiN =
+                    internal ? cellValues[cells[j]] : boundaryValues[facei - nInternalFaces];
+                // the snGrad points out of the owner
+                sum += gammaMagSf
+                     * (deltaCoeffs[facei] * (phiN - phiP) + signs[j] * corrections[facei]);
+            }
+            result[celli] = sum / volume[celli];
+        }
+    );
+}
+
+void Laplacian::assemble(
+    const fvcc::SurfaceField<NeoFOAM::scalar>& gamma,
+    const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+    LduSystem& system,
+    const NeoFOAM::scalar scale
+) const
+{
+    snGrad_.correction(phi, faceCorrection_);
+
+    const CellConnectivity& connectivity = mesh_.cellConnectivity();
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh_.nfMesh();
+    const NeoFOAM::label nInternalFaces = nfMesh.nInternalFaces();
+    const auto offsets = connectivity.offsets.span();
+    const auto faces = connectivity.faces.span();
+    const auto cells = connectivity.cells.span();
+    const auto signs = connectivity.signs.span();
+    const auto magSf = nfMesh.magFaceAreas().span();
+    const auto boundaryMagSf = nfMesh.boundaryMesh().magSf().span();
+    const auto deltaCoeffs = mesh_.nonOrthGeometry().deltaCoeffs.span();
+    const auto corrections = faceCorrection_.span();
+    const auto gammaf = gamma.internalField().span();
+    const auto valueFraction = phi.boundaryField().valueFraction().span();
+    const auto refValue = phi.boundaryField().refValue().span();
+    const auto refGrad = phi.boundaryField().refGrad().span();
+    auto lower = system.lower.span();
+    auto upper = system.upper.span();
+    auto diag = system.diag.span();
+    auto source = system.source.span();
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, upper.size()},
+        KOKKOS_LAMBDA(const size_t facei) {
+            const NeoFOAM::scalar coeff =
+                scale * gammaf[facei] * magSf[facei] * deltaCoeffs[facei];
+            upper[facei] += coeff;
+            lower[facei] += coeff;
+        }
+    );
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, diag.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            NeoFOAM::scalar diagSum = 0.0;
+            NeoFOAM::scalar sourceSum = 0.0;
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                const NeoFOAM::label facei = faces[j];
+                if (cells[j] >= 0)
+                {
+                    const NeoFOAM::scalar gammaMagSf = gammaf[facei] * magSf[facei];
+                    diagSum -= gammaMagSf * deltaCoeffs[facei];
+                    sourceSum -= signs[j] * gammaMagSf * corrections[facei];
+                }
+                else
+                {
+                    // gradientInternalCoeffs and gradientBoundaryCoeffs of a mixed condition
+                    const NeoFOAM::label bfacei = facei - nInternalFaces;
+                    const NeoFOAM::scalar gammaMagSf = gammaf[facei] * boundaryMagSf[bfacei];
+                    const NeoFOAM::scalar f = valueFraction[bfacei];
+                    diagSum -= gammaMagSf * f * deltaCoeffs[facei];
+                    sourceSum -= gammaMagSf
+                               * (f * deltaCoeffs[facei] * refValue[bfacei]
+                                  + (1.0 - f) * refGrad[bfacei]);
+                }
+            }
+            diag[celli] += scale * diagSum;
+            source[celli] += scale * sourceSum;
+        }
+    );
+}
+
+} // namespace Foam
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "symmTensorField.H"
+
+#include "FoamAdapter/operators/leastSquaresGrad.hpp"
+#include "FoamAdapter/readers.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+// weight vectors of leastSquaresVectors: owner and neighbour side of the internal faces and the
+// flattened boundary faces
+std::tuple<vectorField, vectorField, vectorField> leastSquaresVectors(const fvMesh& mesh)
+{
+    const labelUList& owner = mesh.owner();
+    const labelUList& neighbour = mesh.neighbour();
+    const vectorField& C = mesh.cellCentres();
+    const fvBoundaryMesh& bMesh = mesh.boundary();
+
+    symmTensorField dd(mesh.nCells(), Zero);
+    forAll(owner, facei)
+    {
+        const vector d = C[neighbour[facei]] - C[owner[facei]];
+        const symmTensor wdd = (1.0 / magSqr(d)) * sqr(d);
+        dd[owner[facei]] += wdd;
+        dd[neighbour[facei]] += wdd;
+    }
+
+    PtrList<vectorField> patchDelta(bMesh.size());
+    forAll(bMesh, patchi)
+    {
+        const labelUList& faceCells = bMesh[patchi].faceCells();
+        patchDelta.set(patchi, new vectorField(bMesh[patchi].delta()));
+        const vectorField& pd = patchDelta[patchi];
+        forAll(pd, i)
+        {
+            dd[faceCells[i]] += (1.0 / magSqr(pd[i])) * sqr(pd[i]);
+        }
+    }
+
+    // inv removes the directions without extent, e.g. of 2D meshes
+    const symmTensorField invDd(inv(dd));
+
+    vectorField ownVectors(owner.size());
+    vectorField neiVectors(owner.size());
+    forAll(owner, facei)
+    {
+        const vector d = C[neighbour[facei]] - C[owner[facei]];
+        const scalar magSqrDInv = 1.0 / magSqr(d);
+        ownVectors[facei] = magSqrDInv * (invDd[owner[facei]] & d);
+        neiVectors[facei] = -magSqrDInv * (invDd[neighbour[facei]] & d);
+    }
+
+    vectorField boundaryVectors(computeNBoundaryFaces(mesh));
+    label bFacei = 0;
+    forAll(bMesh, patchi)
+    {
+        const labelUList& faceCells = bMesh[patchi].faceCells();
+        const vectorField& pd = patchDelta[patchi];
+        forAll(pd, i)
+        {
+            boundaryVectors[bFacei++] = (1.0 / magSqr(pd[i])) * (invDd[faceCells[i]] & pd[i]);
+        }
+    }
+
+    return {ownVectors, neiVectors, boundaryVectors};
+}
+
+}
+
+LeastSquaresGrad::LeastSquaresGrad(const MeshAdapter& mesh)
+    : connectivity_(mesh.cellConnectivity())
+    , nInternalFaces_(mesh.nInternalFaces())
+    , weights_(mesh.exec(), connectivity_.faces.size())
+{
+    const NeoFOAM::Executor exec = mesh.exec();
+    const auto [ownVectors, neiVectors, boundaryVectors] = leastSquaresVectors(mesh);
+    const auto nfOwnVectors = fromFoamField(exec, ownVectors);
+    const auto nfNeiVectors = fromFoamField(exec, neiVectors);
+    const auto nfBoundaryVectors = fromFoamField(exec, boundaryVectors);
+
+    const NeoFOAM::label nInternalFaces = nInternalFaces_;
+    const auto own = nfOwnVectors.span();
+    const auto nei = nfNeiVectors.span();
+    const auto boundary = nfBoundaryVectors.span();
+    const auto faces = connectivity_.faces.span();
+    const auto signs = connectivity_.signs.span();
+    auto weights = weights_.span();
+    NeoFOAM::parallelFor(
+        exec,
+        {0, weights.size()},
+        KOKKOS_LAMBDA(const size_t j) {
+            const NeoFOAM::label facei = faces[j];
+            if (facei >= nInternalFaces)
+            {
+                weights[j] = boundary[facei - nInternalFaces];
+            }
+            else
+            {
+                weights[j] = signs[j] > 0 ? own[facei] : nei[facei];
+            }
+        }
+    );
+}
+
+void LeastSquaresGrad::grad(
+    const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+    fvcc::VolumeField<NeoFOAM::Vector>& gradPhi
+) const
+{
+    const NeoFOAM::label nInternalFaces = nInternalFaces_;
+    const auto offsets = connectivity_.offsets.span();
+    const auto faces = connectivity_.faces.span();
+    const auto cells = connectivity_.cells.span();
+    const auto weights = weights_.span();
+    const auto cellValues = phi.internalField().span();
+    const auto boundaryValues = phi.boundaryField().value().span();
+    auto result = gradPhi.internalField().span();
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            const NeoFOAM::scalar phiP = cellValues[celli];
+            NeoFOAM::Vector value(0.0, 0.0, 0.0);
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                const NeoFOAM::scalar phiF = cells[j] >= 0
+                                               ? cellValues[cells[j]]
+                                               : boundaryValues[faces[j] - nInternalFaces];
+                value += (phiF - phiP) * weights[j];
+            }
+            result[celli] = value;
+        }
+    );
+}
+
+} // namespace Foam
@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "volFields.H"
+
+#include "FoamAdapter/operators/limitedGrad.hpp"
+#include "FoamAdapter/readers.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+namespace Foam
+{
+
+CellLimitedGrad::CellLimitedGrad(
+    const MeshAdapter& mesh,
+    std::unique_ptr<GradScheme> basicGrad,
+    const scalar k
+)
+    : mesh_(mesh), basicGrad_(std::move(basicGrad)), k_(k)
+{}
+
+void CellLimitedGrad::grad(
+    const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+    fvcc::VolumeField<NeoFOAM::Vector>& gradPhi
+) const
+{
+    basicGrad_->grad(phi, gradPhi);
+    if (k_ < SMALL)
+    {
+        return;
+    }
+
+    const CellConnectivity& connectivity = mesh_.cellConnectivity();
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh_.nfMesh();
+    const NeoFOAM::label nInternalFaces = nfMesh.nInternalFaces();
+    const NeoFOAM::scalar widen = k_ < 1.0 ? 1.0 / k_ - 1.0 : 0.0;
+    const NeoFOAM::scalar small = SMALL;
+
+    const auto offsets = connectivity.offsets.span();
+    const auto faces = connectivity.faces.span();
+    const auto cells = connectivity.cells.span();
+    const auto C = nfMesh.cellCentres().span();
+    const auto Cf = nfMesh.faceCentres().span();
+    const auto boundaryCf = nfMesh.boundaryMesh().cf().span();
+    const auto cellValues = phi.internalField().span();
+    const auto boundaryValues = phi.boundaryField().value().span();
+    auto result = gradPhi.internalField().span();
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            const NeoFOAM::scalar phiP = cellValues[celli];
+            const NeoFOAM::Vector gradP = result[celli];
+
+            // bounds of the neighbour values relative to the cell value
+            NeoFOAM::scalar maxDelta = 0.0;
+            NeoFOAM::scalar minDelta = 0.0;
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                const NeoFOAM::scalar phiN = cells[j] >= 0
+                                               ? cellValues[cells[j]]
+                                               : boundaryValues[faces[j] - nInternalFaces];
+                maxDelta = Kokkos::max(maxDelta, phiN - phiP);
+                minDelta = Kokkos::min(minDelta, phiN - phiP);
+            }
+            const NeoFOAM::scalar range = widen * (maxDelta - minDelta);
+            maxDelta += range;
+            minDelta -= range;
+
+            // minmod of the ratios of the bounds to the extrapolations to the face centres
+            NeoFOAM::scalar limiter = 1.0;
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                const NeoFOAM::label facei = faces[j];
+                const NeoFOAM::Vector cf =
+                    facei < nInternalFaces ? Cf[facei] : boundaryCf[facei - nInternalFaces];
+                const NeoFOAM::scalar extrapolate = (cf - C[celli]) & gradP;
+                if (extrapolate > small)
+                {
+                    limiter = Kokkos::min(limiter, maxDelta / extrapolate);
+                }
+                else if (extrapolate < -small)
+                {
+                    limiter = Kokkos::min(limiter, minDelta / extrapolate);
+                }
+            }
+            result[celli] = limiter * gradP;
+        }
+    );
+}
+
+FaceLimitedGrad::FaceLimitedGrad(
+    const MeshAdapter& mesh,
+    std::unique_ptr<GradScheme> basicGrad,
+    const scalar k
+)
+    : mesh_(mesh), basicGrad_(std::move(basicGrad)), k_(k)
+{}
+
+const NeoFOAM::Field<NeoFOAM::label>& FaceLimitedGrad::fixesValue(const std::string& name) const
+{
+    auto it = fixesValue_.find(name);
+    if (it == fixesValue_.end())
+    {
+        labelList fixesValue(computeNBoundaryFaces(mesh_), 0);
+        const volScalarField* field = mesh_.findObject<volScalarField>(name);
+        if (field)
+        {
+            const std::vector<NeoFOAM::localIdx> offset = computeOffset(mesh_);
+            forAll(field->boundaryField(), patchi)
+            {
+                if (field->boundaryField()[patchi].fixesValue())
+                {
+                    for (auto i = offset[patchi]; i < offset[patchi + 1]; i++)
+                    {
+                        fixesValue[i] = 1;
+                    }
+                }
+            }
+        }
+        it = fixesValue_.emplace(name, fromFoamField(mesh_.exec(), fixesValue)).first;
+    }
+    return it->second;
+}
+
+void FaceLimitedGrad::grad(
+    const fvcc::VolumeField<NeoFOAM::scalar>& phi,
+    fvcc::VolumeField<NeoFOAM::Vector>& gradPhi
+) const
+{
+    basicGrad_->grad(phi, gradPhi);
+    if (k_ < SMALL)
+    {
+        return;
+    }
+
+    const CellConnectivity& connectivity = mesh_.cellConnectivity();
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh_.nfMesh();
+    const NeoFOAM::label nInternalFaces = nfMesh.nInternalFaces();
+    const NeoFOAM::scalar widen = k_ < 1.0 ? 1.0 / k_ - 1.0 : 0.0;
+    const NeoFOAM::scalar vSmall = VSMALL;
+
+    const auto offsets = connectivity.offsets.span();
+    const auto faces = connectivity.faces.span();
+    const auto cells = connectivity.cells.span();
+    const auto C = nfMesh.cellCentres().span();
+    const auto Cf = nfMesh.faceCentres().span();
+    const auto boundaryCf = nfMesh.boundaryMesh().cf().span();
+    const auto boundaryFixesValue = fixesValue(phi.name).span();
+    const auto cellValues = phi.internalField().span();
+    const auto boundaryValues = phi.boundaryField().value().span();
+    auto result = gradPhi.internalField().span();
+
+    NeoFOAM::parallelFor(
+        phi.exec(),
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            const NeoFOAM::scalar phiP = cellValues[celli];
+            const NeoFOAM::Vector gradP = result[celli];
+            NeoFOAM::scalar limiter = 1.0;
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                const NeoFOAM::label facei = faces[j];
+                NeoFOAM::scalar phiN;
+                NeoFOAM::Vector cf;
+                if (cells[j] >= 0)
+                {
+                    phiN = cellValues[cells[j]];
+                    cf = Cf[facei];
+                }
+                else if (boundaryFixesValue[facei - nInternalFaces])
+                {
+                    phiN = boundaryValues[facei - nInternalFaces];
+                    cf = boundaryCf[facei - nInternalFaces];
+                }
+                else
+                {
+                    continue;
+                }
+
+                // bounds of the face values relative to the cell value
+                NeoFOAM::scalar maxDelta = Kokkos::max(phiP, phiN) - phiP;
+                NeoFOAM::scalar minDelta = Kokkos::min(phiP, phiN) - phiP;
+                const NeoFOAM::scalar range = widen * (maxDelta - minDelta);
+                maxDelta += range;
+                minDelta -= range;
+
+                const NeoFOAM::scalar extrapolate = (cf - C[celli]) & gradP;
+                if (extrapolate > maxDelta + vSmall)
+                {
+                    limiter = Kokkos::min(limiter, maxDelta / extrapolate);
+                }
+                else if (extrapolate < minDelta - vSmall)
+                {
+                    limiter = Kokkos::min(limiter, minDelta / extrapolate);
+                }
+            }
+            result[celli] = limiter * gradP;
+        }
+    );
+}
+
+} // namespace Foam
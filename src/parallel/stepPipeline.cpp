@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "error.H"
+
+#include "FoamAdapter/parallel/stepPipeline.hpp"
+
+namespace Foam
+{
+
+StepPipeline::StepPipeline(const label nThreads) : pool_(nThreads) {}
+
+StepPipeline::~StepPipeline() { pool_.wait(); }
+
+StepPipeline::TaskId StepPipeline::add(
+    const word& name,
+    Task task,
+    const std::vector<TaskId>& dependencies,
+    const Stage stage
+)
+{
+    const TaskId id = step_.size();
+    for (const TaskId dependency : dependencies)
+    {
+        if (dependency < 0 || dependency >= id)
+        {
+            FatalErrorInFunction << "task " << name << " depends on unknown task " << dependency
+                                 << abort(FatalError);
+        }
+        if (stage == Stage::foreground && step_[dependency]->stage == Stage::background)
+        {
+            FatalErrorInFunction << "foreground task " << name << " depends on background task "
+                                 << step_[dependency]->name << abort(FatalError);
+        }
+    }
+
+    auto node = std::make_shared<Node>();
+    node->name = name;
+    node->task = std::move(task);
+    node->stage = stage;
+    node->dependencies = dependencies;
+    step_.push_back(node);
+    return id;
+}
+
+void StepPipeline::addEdge(const std::shared_ptr<Node>& pred, const std::shared_ptr<Node>& succ)
+{
+    std::lock_guard<std::mutex> lock(pred->mutex);
+    if (!pred->done)
+    {
+        pred->successors.push_back(succ);
+        succ->nWaiting++;
+    }
+}
+
+void StepPipeline::launch(const std::shared_ptr<Node>& node)
+{
+    pool_.submit(
+        [this, node]()
+        {
+            try
+            {
+                node->task();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex_);
+                if (!error_)
+                {
+                    error_ = std::current_exception();
+                }
+            }
+
+            std::vector<std::shared_ptr<Node>> successors;
+            {
+                std::lock_guard<std::mutex> lock(node->mutex);
+                node->done = true;
+                successors.swap(node->successors);
+            }
+            for (const auto& successor : successors)
+            {
+                if (--successor->nWaiting == 0)
+                {
+                    launch(successor);
+                }
+            }
+        }
+    );
+}
+
+void StepPipeline::run()
+{
+    rethrow();
+
+    // dependencies precede their tasks, so the insertion order is a valid order
+    for (const auto& node : step_)
+    {
+        if (node->stage == Stage::foreground)
+        {
+            node->task();
+            node->done = true;
+        }
+    }
+
+    for (const auto& node : step_)
+    {
+        if (node->stage == Stage::foreground)
+        {
+            continue;
+        }
+
+        // the guard count prevents a launch before all edges are added
+        node->nWaiting = 1;
+        for (const TaskId dependency : node->dependencies)
+        {
+            addEdge(step_[dependency], node);
+        }
+        auto previous = lastBackground_.find(node->name);
+        if (previous != lastBackground_.end())
+        {
+            addEdge(previous->second, node);
+        }
+        lastBackground_[node->name] = node;
+        if (--node->nWaiting == 0)
+        {
+            launch(node);
+        }
+    }
+
+    step_.clear();
+}
+
+void StepPipeline::finish()
+{
+    pool_.wait();
+    lastBackground_.clear();
+    rethrow();
+}
+
+void StepPipeline::rethrow()
+{
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        std::swap(error, error_);
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace Foam
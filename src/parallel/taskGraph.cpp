@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <algorithm>
+#include <future>
+
+#include "error.H"
+
+#include "FoamAdapter/parallel/taskGraph.hpp"
+
+namespace Foam
+{
+
+TaskGraph::TaskGraph(const label maxConcurrency)
+    : maxConcurrency_(
+        maxConcurrency > 0 ? maxConcurrency : Kokkos::DefaultHostExecutionSpace().concurrency()
+    )
+    , tasks_()
+{}
+
+TaskGraph::TaskId
+TaskGraph::add(const word& name, Task task, const std::vector<TaskId>& dependencies)
+{
+    const TaskId id = tasks_.size();
+    for (const TaskId dependency : dependencies)
+    {
+        if (dependency < 0 || dependency >= id)
+        {
+            FatalErrorInFunction << "task " << name << " depends on unknown task " << dependency
+                                 << abort(FatalError);
+        }
+    }
+    tasks_.push_back(Node {name, std::move(task), dependencies});
+    return id;
+}
+
+std::vector<std::vector<TaskGraph::TaskId>> TaskGraph::waves() const
+{
+    // dependencies always precede a task, so a single pass assigns the levels
+    std::vector<label> level(tasks_.size(), 0);
+    std::vector<std::vector<TaskId>> result;
+    for (size_t id = 0; id < tasks_.size(); id++)
+    {
+        for (const TaskId dependency : tasks_[id].dependencies)
+        {
+            level[id] = std::max(level[id], level[dependency] + 1);
+        }
+        if (static_cast<size_t>(level[id]) >= result.size())
+        {
+            result.resize(level[id] + 1);
+        }
+        result[level[id]].push_back(id);
+    }
+    return result;
+}
+
+void TaskGraph::run() const
+{
+    const Kokkos::DefaultHostExecutionSpace hostSpace;
+    for (const auto& wave : waves())
+    {
+        for (size_t first = 0; first < wave.size(); first += maxConcurrency_)
+        {
+            const size_t nTasks = std::min(wave.size() - first, size_t(maxConcurrency_));
+            if (nTasks == 1)
+            {
+                const Node& node = tasks_[wave[first]];
+                node.task(TaskContext {wave[first], node.name, hostSpace});
+                hostSpace.fence();
+                continue;
+            }
+
+            auto partitions = Kokkos::Experimental::partition_space(
+                hostSpace, std::vector<double>(nTasks, 1.0)
+            );
+            std::vector<std::future<void>> running;
+            for (size_t i = 0; i < nTasks; i++)
+            {
+                const TaskId id = wave[first + i];
+                const Node& node = tasks_[id];
+                running.push_back(std::async(
+                    std::launch::async,
+                    [&node, id, space = partitions[i]]()
+                    {
+                        node.task(TaskContext {id, node.name, space});
+                        space.fence();
+                    }
+                ));
+            }
+
+            // join before the next wave, rethrows the exception of a failed task
+            for (auto& task : running)
+            {
+                task.wait();
+            }
+            for (auto& task : running)
+            {
+                task.get();
+            }
+        }
+    }
+}
+
+} // namespace Foam
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <algorithm>
+
+#include "FoamAdapter/parallel/workStealingPool.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+// pool and queue of the calling thread if it is a worker
+thread_local const WorkStealingPool* currentPool = nullptr;
+thread_local size_t currentWorker = 0;
+
+}
+
+WorkStealingPool::WorkStealingPool(const label nThreads)
+{
+    const size_t n = nThreads > 0 ? size_t(nThreads)
+                                  : std::max(std::thread::hardware_concurrency() / 2, 1u);
+    for (size_t i = 0; i < n; i++)
+    {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        workers_.emplace_back([this, i]() { work(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wakeUp_.notify_all();
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::submit(Job job)
+{
+    const size_t queuei =
+        currentPool == this ? currentWorker : next_.fetch_add(1) % queues_.size();
+    {
+        std::lock_guard<std::mutex> lock(queues_[queuei]->mutex);
+        queues_[queuei]->jobs.push_back(std::move(job));
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        nPending_++;
+        nQueued_++;
+    }
+    wakeUp_.notify_one();
+}
+
+void WorkStealingPool::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return nPending_ == 0; });
+}
+
+bool WorkStealingPool::tryPop(const size_t workeri, Job& job)
+{
+    {
+        Queue& own = *queues_[workeri];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty())
+        {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            return true;
+        }
+    }
+    for (size_t i = 1; i < queues_.size(); i++)
+    {
+        Queue& victim = *queues_[(workeri + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty())
+        {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::work(const size_t workeri)
+{
+    currentPool = this;
+    currentWorker = workeri;
+
+    Job job;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeUp_.wait(lock, [this]() { return stop_ || nQueued_ > 0; });
+            if (nQueued_ == 0)
+            {
+                return;
+            }
+            nQueued_--;
+        }
+
+        // a job is reserved for this worker, but it may sit in any queue
+        while (!tryPop(workeri, job))
+        {
+            std::this_thread::yield();
+        }
+        job();
+        job = nullptr;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--nPending_ == 0)
+        {
+            idle_.notify_all();
+        }
+    }
+}
+
+} // namespace Foam
@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "FoamAdapter/profiling/kernelProfiler.hpp"
+#include "FoamAdapter/setup/executorTuning.hpp"
+#include "FoamAdapter/meshAdapter.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+#if defined(__linux__)
+
+std::vector<int> threadIds()
+{
+    std::vector<int> tids;
+    DIR* dir = opendir("/proc/self/task");
+    if (!dir)
+    {
+        return tids;
+    }
+    while (dirent* entry = readdir(dir))
+    {
+        if (entry->d_name[0] != '.')
+        {
+            tids.push_back(std::atoi(entry->d_name));
+        }
+    }
+    closedir(dir);
+    return tids;
+}
+
+int openCounter(const int tid, const uint64_t config)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(__NR_perf_event_open, &attr, tid, -1, -1, 0);
+}
+
+#endif
+
+}
+
+PerfCounters::PerfCounters(const bool enable)
+{
+    if (!enable)
+    {
+        return;
+    }
+#if defined(__linux__)
+    const std::array<uint64_t, nEvents> configs {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES
+    };
+    available_.fill(true);
+    for (const int tid : threadIds())
+    {
+        std::array<int, nEvents> fds;
+        for (size_t event = 0; event < nEvents; event++)
+        {
+            fds[event] = openCounter(tid, configs[event]);
+            available_[event] = available_[event] && fds[event] >= 0;
+        }
+        fds_.push_back(fds);
+    }
+    if (fds_.empty())
+    {
+        available_.fill(false);
+    }
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#if defined(__linux__)
+    for (const auto& fds : fds_)
+    {
+        for (const int fd : fds)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+    }
+#endif
+}
+
+void PerfCounters::start()
+{
+#if defined(__linux__)
+    for (const auto& fds : fds_)
+    {
+        for (size_t event = 0; event < nEvents; event++)
+        {
+            if (available_[event])
+            {
+                ioctl(fds[event], PERF_EVENT_IOC_RESET, 0);
+                ioctl(fds[event], PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+    }
+#endif
+}
+
+PerfCounters::Values PerfCounters::stop()
+{
+    Values values {};
+#if defined(__linux__)
+    for (const auto& fds : fds_)
+    {
+        for (size_t event = 0; event < nEvents; event++)
+        {
+            if (available_[event])
+            {
+                ioctl(fds[event], PERF_EVENT_IOC_DISABLE, 0);
+                uint64_t value = 0;
+                if (read(fds[event], &value, sizeof(value)) == sizeof(value))
+                {
+                    values[event] += value;
+                }
+            }
+        }
+    }
+#endif
+    return values;
+}
+
+std::map<std::string, KernelCost> operatorCosts(const fvMesh& mesh)
+{
+    const double nCells = mesh.nCells();
+    const double nInternalFaces = mesh.nInternalFaces();
+    const double nBoundaryFaces = computeNBoundaryFaces(mesh);
+    const double s = sizeof(NeoFOAM::scalar);
+    const double l = sizeof(NeoFOAM::label);
+
+    std::map<std::string, KernelCost> costs;
+
+    // owner, neighbour, weight, two cell values and the face value
+    // w*a + (1 - w)*b
+    costs["interpolation"] = {
+        .bytes = nInternalFaces * (2 * l + 4 * s) + nBoundaryFaces * 2 * s,
+        .flops = nInternalFaces * 4
+    };
+
+    // interpolation, flux and read modify write of both cells, division by the volume
+    costs["div"] = {
+        .bytes =
+            nInternalFaces * (2 * l + 8 * s) + nBoundaryFaces * (l + 4 * s) + nCells * 3 * s,
+        .flops = nInternalFaces * 7 + nBoundaryFaces * 2 + nCells
+    };
+
+    // interpolation, face area vector and read modify write of both cell vectors
+    costs["grad"] = {
+        .bytes =
+            nInternalFaces * (2 * l + 18 * s) + nBoundaryFaces * (l + 10 * s) + nCells * 7 * s,
+        .flops = nInternalFaces * 13 + nBoundaryFaces * 6 + nCells * 3
+    };
+
+    // face cell, cell value and boundary value
+    costs["bcUpdate"] = {.bytes = nBoundaryFaces * (l + 2 * s), .flops = 0};
+
+    return costs;
+}
+
+KernelProfiler::KernelProfiler(
+    const double peakBandwidth,
+    const double peakFlops,
+    const bool hardwareCounters
+)
+    : peakBandwidth_(peakBandwidth)
+    , peakFlops_(peakFlops)
+    , counters_(hardwareCounters)
+    , stats_()
+{}
+
+void KernelProfiler::write(Ostream& os) const
+{
+    const bool haveCycles = counters_.available(PerfCounters::cycles);
+    const bool haveInstructions = counters_.available(PerfCounters::instructions);
+    const bool haveMisses = counters_.available(PerfCounters::llcMisses);
+    if (!haveCycles && !haveInstructions && !haveMisses)
+    {
+        os << "Hardware counters unavailable, reporting model based rates only" << nl;
+    }
+
+    for (const auto& [name, stats] : stats_)
+    {
+        if (stats.calls == 0 || stats.time <= 0)
+        {
+            continue;
+        }
+        const double time = stats.time / stats.calls;
+        const double bandwidth = stats.cost.bytes / time;
+        const double flopRate = stats.cost.flops / time;
+        const double intensity = stats.cost.flops / max(stats.cost.bytes, 1.0);
+
+        os << "    " << name.c_str() << ": " << time << " s, " << bandwidth / 1e9 << " GB/s, "
+           << flopRate / 1e9 << " GFLOP/s, intensity " << intensity << " flop/byte";
+        if (haveCycles && haveInstructions && stats.counters[PerfCounters::cycles] > 0)
+        {
+            os << ", IPC "
+               << double(stats.counters[PerfCounters::instructions])
+                      / stats.counters[PerfCounters::cycles];
+        }
+        if (haveMisses)
+        {
+            // every last level cache miss transfers one cache line
+            const double missBytes = 64.0 * stats.counters[PerfCounters::llcMisses] / stats.calls;
+            os << ", LLC misses " << missBytes / 64.0 << " (" << missBytes / time / 1e9
+               << " GB/s)";
+        }
+        if (peakBandwidth_ > 0 && peakFlops_ > 0 && intensity > 0)
+        {
+            const double attainable = min(peakFlops_, intensity * peakBandwidth_);
+            os << ", " << 100.0 * flopRate / attainable << "% of roofline";
+        }
+        os << nl;
+    }
+}
+
+void profileKernels(const NeoFOAM::Executor& exec, const fvMesh& mesh, const dictionary& dict)
+{
+    const dictionary profilingDict = dict.subOrEmptyDict("kernelProfiling");
+    if (!profilingDict.getOrDefault<bool>("active", false))
+    {
+        return;
+    }
+    const label nRepetitions = max(profilingDict.getOrDefault<label>("repetitions", 10), 1);
+
+    KernelProfiler profiler(
+        profilingDict.getOrDefault<scalar>("peakBandwidth", 0),
+        profilingDict.getOrDefault<scalar>("peakFlops", 0),
+        profilingDict.getOrDefault<bool>("hardwareCounters", true)
+    );
+    calibrateExecutor(exec, mesh, nRepetitions, &profiler);
+
+    const std::string execName = std::visit([](const auto& e) { return e.name(); }, exec);
+    Info << "Kernel profile on " << execName.c_str() << " ("
+         << returnReduce(mesh.nCells(), sumOp<label>()) << " cells)" << nl;
+    profiler.write(Info);
+    Info << endl;
+}
+
+} // namespace Foam
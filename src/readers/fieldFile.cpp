@@ -0,0 +1,421 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+#include "IStringStream.H"
+
+#include "FoamAdapter/readers/fieldFile.hpp"
+#include "FoamAdapter/memory/hugePages.hpp"
+#include "FoamAdapter/conversion/convert.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+// parentheses of vector entries are treated as separators, i.e. the payload is a sequence
+// of scalars
+inline bool isSeparator(const char c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '(' || c == ')';
+}
+
+size_t countTokens(const char* begin, const char* end)
+{
+    size_t n = 0;
+    bool inToken = false;
+    for (const char* p = begin; p < end; p++)
+    {
+        const bool separator = isSeparator(*p);
+        n += !separator && !inToken;
+        inToken = !separator;
+    }
+    return n;
+}
+
+bool parseTokens(const char* begin, const char* end, double* out)
+{
+    const char* p = begin;
+    while (true)
+    {
+        while (p < end && isSeparator(*p))
+        {
+            p++;
+        }
+        if (p == end)
+        {
+            return true;
+        }
+        auto [next, ec] = std::from_chars(p, end, *out);
+        if (ec != std::errc() || (next < end && !isSeparator(*next)))
+        {
+            return false;
+        }
+        out++;
+        p = next;
+    }
+}
+
+// moves p behind the token it points into unless p starts a token
+const char* alignToToken(const char* begin, const char* end, const char* p)
+{
+    if (p > begin)
+    {
+        while (p < end && !isSeparator(p[-1]) && !isSeparator(*p))
+        {
+            p++;
+        }
+    }
+    return p;
+}
+
+// reads size scalars from the ascii payload in parallel chunks
+void parseAscii(const char* begin, const char* end, double* out, const size_t size)
+{
+    using HostSpace = Kokkos::DefaultHostExecutionSpace;
+    const size_t nChunks = std::max<size_t>(
+        1, std::min<size_t>(4 * HostSpace().concurrency(), (end - begin) / (1 << 16))
+    );
+
+    std::vector<const char*> bounds(nChunks + 1);
+    for (size_t chunki = 0; chunki <= nChunks; chunki++)
+    {
+        const char* p = begin + (end - begin) * chunki / nChunks;
+        bounds[chunki] = chunki == nChunks ? end : alignToToken(begin, end, p);
+    }
+
+    std::vector<size_t> offsets(nChunks + 1, 0);
+    const char* const* b = bounds.data();
+    size_t* counts = offsets.data() + 1;
+    Kokkos::parallel_for(
+        "FieldFile::countTokens",
+        Kokkos::RangePolicy<HostSpace>(0, nChunks),
+        [=](const size_t chunki) { counts[chunki] = countTokens(b[chunki], b[chunki + 1]); }
+    );
+    for (size_t chunki = 0; chunki < nChunks; chunki++)
+    {
+        offsets[chunki + 1] += offsets[chunki];
+    }
+    if (offsets.back() != size)
+    {
+        FatalErrorInFunction << "expected " << size << " values but found " << offsets.back()
+                             << exit(FatalError);
+    }
+
+    std::vector<char> ok(nChunks, 0);
+    const size_t* o = offsets.data();
+    char* chunkOk = ok.data();
+    Kokkos::parallel_for(
+        "FieldFile::parseTokens",
+        Kokkos::RangePolicy<HostSpace>(0, nChunks),
+        [=](const size_t chunki)
+        { chunkOk[chunki] = parseTokens(b[chunki], b[chunki + 1], out + o[chunki]); }
+    );
+    for (size_t chunki = 0; chunki < nChunks; chunki++)
+    {
+        if (!chunkOk[chunki])
+        {
+            FatalErrorInFunction << "cannot parse the values of chunk " << chunki
+                                 << " starting with: "
+                                 << std::string(b[chunki], std::min(b[chunki] + 40, end)).c_str()
+                                 << exit(FatalError);
+        }
+    }
+}
+
+// copies the binary payload in parallel chunks so the pages are first touched in parallel
+void copyBinary(const char* begin, double* out, const size_t size)
+{
+    using HostSpace = Kokkos::DefaultHostExecutionSpace;
+    const size_t nChunks = std::max<size_t>(1, std::min<size_t>(HostSpace().concurrency(), size));
+    char* dst = reinterpret_cast<char*>(out);
+    const size_t nBytes = size * sizeof(double);
+    Kokkos::parallel_for(
+        "FieldFile::copyBinary",
+        Kokkos::RangePolicy<HostSpace>(0, nChunks),
+        [=](const size_t chunki)
+        {
+            const size_t start = nBytes * chunki / nChunks;
+            const size_t end = nBytes * (chunki + 1) / nChunks;
+            std::memcpy(dst + start, begin + start, end - start);
+        }
+    );
+}
+
+size_t skipSpace(std::string_view text, size_t pos)
+{
+    while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+    {
+        pos++;
+    }
+    return pos;
+}
+
+// position after the keyword, which has to be delimited by separators
+size_t findKeyword(std::string_view text, std::string_view keyword, size_t pos)
+{
+    while ((pos = text.find(keyword, pos)) != std::string_view::npos)
+    {
+        const size_t end = pos + keyword.size();
+        const bool delimitedBefore = pos == 0
+                                  || std::isspace(static_cast<unsigned char>(text[pos - 1]))
+                                  || text[pos - 1] == ';' || text[pos - 1] == '{';
+        const bool delimitedAfter =
+            end < text.size() && std::isspace(static_cast<unsigned char>(text[end]));
+        if (delimitedBefore && delimitedAfter)
+        {
+            return end;
+        }
+        pos = end;
+    }
+    return std::string_view::npos;
+}
+
+}
+
+FieldFile::FieldFile(const fileName& file) : file_(file)
+{
+    fd_ = open(file.c_str(), O_RDONLY);
+    struct stat info;
+    if (fd_ < 0 || fstat(fd_, &info) != 0)
+    {
+        FatalErrorInFunction << "cannot open field file " << file << exit(FatalError);
+    }
+    size_ = info.st_size;
+    void* mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (mapped == MAP_FAILED)
+    {
+        FatalErrorInFunction << "cannot map field file " << file << exit(FatalError);
+    }
+    data_ = static_cast<const char*>(mapped);
+    madvise(mapped, size_, MADV_SEQUENTIAL);
+
+    const std::string_view text(data_, size_);
+    auto fail = [&](const char* msg)
+    {
+        FatalErrorInFunction << msg << " in field file " << file_ << exit(FatalError);
+    };
+
+    // header
+    size_t pos = findKeyword(text, "FoamFile", 0);
+    const size_t headerBegin = pos == std::string_view::npos ? pos : text.find('{', pos);
+    const size_t headerEnd =
+        headerBegin == std::string_view::npos ? headerBegin : text.find('}', headerBegin);
+    if (headerEnd == std::string_view::npos)
+    {
+        fail("missing FoamFile header");
+    }
+    {
+        IStringStream is(std::string(text.substr(headerBegin + 1, headerEnd - headerBegin - 1)));
+        header_ = dictionary(is);
+    }
+    binary_ = header_.getOrDefault<word>("format", "ascii") == "binary";
+    if (binary_)
+    {
+        const string arch = header_.getOrDefault<string>("arch", "scalar=64");
+        if (arch.find("scalar=64") == string::npos)
+        {
+            fail("binary format requires 64 bit scalars");
+        }
+    }
+
+    // internalField
+    const size_t internalBegin = findKeyword(text, "internalField", headerEnd);
+    if (internalBegin == std::string_view::npos)
+    {
+        fail("missing internalField");
+    }
+    const size_t keywordBegin = internalBegin - std::string_view("internalField").size();
+    preamble_ = text.substr(headerEnd + 1, keywordBegin - headerEnd - 1);
+
+    pos = skipSpace(text, internalBegin);
+    size_t tailBegin = std::string_view::npos;
+    if (text.substr(pos, 7) == "uniform")
+    {
+        const size_t valueEnd = text.find(';', pos);
+        uniform_ = true;
+        uniformValue_ = text.substr(pos + 7, valueEnd - pos - 7);
+        tailBegin = valueEnd + 1;
+    }
+    else if (text.substr(pos, 10) == "nonuniform")
+    {
+        pos = skipSpace(text, pos + 10);
+        const size_t typeEnd = text.find('>', pos);
+        const std::string_view listType = text.substr(pos, typeEnd + 1 - pos);
+        if (listType == "List<scalar>")
+        {
+            nComponents_ = 1;
+        }
+        else if (listType == "List<vector>")
+        {
+            nComponents_ = 3;
+        }
+        else
+        {
+            fail("unsupported internalField type");
+        }
+
+        pos = skipSpace(text, typeEnd + 1);
+        auto [next, ec] = std::from_chars(data_ + pos, data_ + size_, nEntries_);
+        if (ec != std::errc())
+        {
+            fail("missing size of the internalField");
+        }
+        pos = skipSpace(text, next - data_);
+
+        if (text[pos] == '{')
+        {
+            // compact list of identical values
+            const size_t valueEnd = text.find('}', pos);
+            uniform_ = true;
+            uniformValue_ = text.substr(pos + 1, valueEnd - pos - 1);
+            tailBegin = text.find(';', valueEnd) + 1;
+        }
+        else if (text[pos] == '(' && binary_)
+        {
+            payloadBegin_ = data_ + pos + 1;
+            payloadEnd_ = payloadBegin_ + size_t(nEntries_) * nComponents_ * sizeof(double);
+            if (payloadEnd_ >= data_ + size_ || *payloadEnd_ != ')')
+            {
+                fail("truncated binary internalField");
+            }
+            tailBegin = text.find(';', payloadEnd_ - data_) + 1;
+        }
+        else if (text[pos] == '(')
+        {
+            // the payload ends with the last semicolon before the boundaryField
+            payloadBegin_ = data_ + pos + 1;
+            const size_t boundaryBegin = findKeyword(text, "boundaryField", pos);
+            const size_t payloadEnd = text.rfind(';', boundaryBegin);
+            if (boundaryBegin == std::string_view::npos || payloadEnd < pos)
+            {
+                fail("missing boundaryField");
+            }
+            payloadEnd_ = data_ + payloadEnd;
+            tailBegin = payloadEnd + 1;
+        }
+        else
+        {
+            fail("cannot read internalField");
+        }
+    }
+    else
+    {
+        fail("internalField is neither uniform nor nonuniform");
+    }
+
+    if (tailBegin == std::string_view::npos || tailBegin > size_)
+    {
+        fail("missing end of internalField");
+    }
+    tail_ = text.substr(tailBegin);
+}
+
+FieldFile::~FieldFile()
+{
+    if (data_)
+    {
+        munmap(const_cast<char*>(data_), size_);
+    }
+    if (fd_ >= 0)
+    {
+        close(fd_);
+    }
+}
+
+dictionary FieldFile::boundaryField(const polyBoundaryMesh& bMesh) const
+{
+    // $internalField references in the boundaryField expand to a zero placeholder
+    const std::string placeholder = nComponents_ == 1 ? "uniform 0" : "uniform (0 0 0)";
+    // the lists of the patches, e.g. value nonuniform List<scalar>, are in the file format
+    IStringStream is(
+        preamble_ + "\ninternalField " + placeholder + ";\n" + tail_,
+        IOstreamOption(binary_ ? IOstreamOption::BINARY : IOstreamOption::ASCII)
+    );
+    dictionary content(is);
+    const dictionary& bField = content.subDict("boundaryField");
+
+    dictionary ordered;
+    forAll(bMesh, patchi)
+    {
+        ordered.add(bMesh[patchi].name(), bField.subDict(bMesh[patchi].name()));
+    }
+    return ordered;
+}
+
+template<typename ValueType>
+NeoFOAM::Field<ValueType>
+FieldFile::internalField(const NeoFOAM::Executor& exec, const label size) const
+{
+    constexpr label nComponents = sizeof(ValueType) / sizeof(NeoFOAM::scalar);
+    if (nComponents != nComponents_)
+    {
+        FatalErrorInFunction << "field file " << file_ << " has " << nComponents_
+                             << " components per value, requested " << nComponents
+                             << exit(FatalError);
+    }
+    if (nEntries_ >= 0 && nEntries_ != size)
+    {
+        FatalErrorInFunction << "field file " << file_ << " has " << nEntries_
+                             << " values, expected " << size << exit(FatalError);
+    }
+
+    if (uniform_)
+    {
+        NeoFOAM::Field<ValueType> field(exec, size);
+        IStringStream is(uniformValue_);
+        if constexpr (nComponents == 1)
+        {
+            NeoFOAM::fill(field, readScalar(is));
+        }
+        else
+        {
+            NeoFOAM::fill(field, convert(vector(is)));
+        }
+        return field;
+    }
+
+    // host executors are filled in place, the GPU is filled from a host buffer
+    const bool host = !std::holds_alternative<NeoFOAM::GPUExecutor>(exec);
+    const NeoFOAM::Executor hostExec = host ? exec : NeoFOAM::Executor(NeoFOAM::SerialExecutor());
+    NeoFOAM::Field<ValueType> hostField(hostExec, size);
+    detail::adviseHugePages(hostField.data(), size * sizeof(ValueType));
+    double* out = reinterpret_cast<double*>(hostField.data());
+    if (binary_)
+    {
+        copyBinary(payloadBegin_, out, size_t(size) * nComponents);
+    }
+    else
+    {
+        parseAscii(payloadBegin_, payloadEnd_, out, size_t(size) * nComponents);
+    }
+
+    if (host)
+    {
+        return hostField;
+    }
+    return NeoFOAM::Field<ValueType>(exec, hostField.data(), hostField.size());
+}
+
+template NeoFOAM::Field<NeoFOAM::scalar>
+FieldFile::internalField<NeoFOAM::scalar>(const NeoFOAM::Executor&, const label) const;
+
+template NeoFOAM::Field<NeoFOAM::Vector>
+FieldFile::internalField<NeoFOAM::Vector>(const NeoFOAM::Executor&, const label) const;
+
+} // namespace Foam
@@ -2,6 +2,12 @@
 // SPDX-FileCopyrightText: 2023 NeoFOAM authors
 
 #include "FoamAdapter/setup.hpp"
+#include "FoamAdapter/setup/executorTuning.hpp"
+#include "FoamAdapter/memory/hugePages.hpp"
+#include "FoamAdapter/setup/meshConversion.hpp"
+#include "FoamAdapter/parallel/reduce.hpp"
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
 
 namespace Foam
 {
@@ -30,6 +36,56 @@ scalar calculateCoNum(const surfaceScalarField& phi)
     return coNum;
 }
 
+scalar calculateCoNum(
+    const MeshAdapter& mesh,
+    const NeoFOAM::finiteVolume::cellCentred::SurfaceField<NeoFOAM::scalar>& phi,
+    scalar deltaT
+)
+{
+    const CellConnectivity& connectivity = mesh.cellConnectivity();
+    const auto offsets = connectivity.offsets.span();
+    const auto faces = connectivity.faces.span();
+    const auto flux = phi.internalField().span();
+    const auto volume = mesh.nfMesh().cellVolumes().span();
+
+    // surfaceSum(mag(phi)) gathered per cell and reduced in the same pass
+    NeoFOAM::scalar maxRatio = 0;
+    NeoFOAM::scalar sumPhi = 0;
+    NeoFOAM::scalar sumV = 0;
+    detail::parallelReduce(
+        phi.exec(),
+        "calculateCoNum",
+        {0, volume.size()},
+        KOKKOS_LAMBDA(
+            const size_t celli,
+            NeoFOAM::scalar& lmax,
+            NeoFOAM::scalar& lsumPhi,
+            NeoFOAM::scalar& lsumV
+        ) {
+            NeoFOAM::scalar cellSum = 0;
+            for (NeoFOAM::label j = offsets[celli]; j < offsets[celli + 1]; j++)
+            {
+                cellSum += Kokkos::abs(flux[faces[j]]);
+            }
+            lmax = Kokkos::fmax(lmax, cellSum / volume[celli]);
+            lsumPhi += cellSum;
+            lsumV += volume[celli];
+        },
+        Kokkos::Max<NeoFOAM::scalar>(maxRatio),
+        Kokkos::Sum<NeoFOAM::scalar>(sumPhi),
+        Kokkos::Sum<NeoFOAM::scalar>(sumV)
+    );
+
+    scalar coNum = 0.5 * returnReduce(scalar(maxRatio), maxOp<scalar>()) * deltaT;
+    scalar meanCoNum = 0.5
+                     * (returnReduce(scalar(sumPhi), sumOp<scalar>())
+                        / returnReduce(scalar(sumV), sumOp<scalar>()))
+                     * deltaT;
+
+    Info << "Courant Number mean: " << meanCoNum << " max: " << coNum << endl;
+    return coNum;
+}
+
 void setDeltaT(Time& runTime, scalar maxCo, scalar coNum, scalar maxDeltaT)
 {
     scalar maxDeltaTFact = maxCo / (coNum + SMALL);
@@ -43,9 +99,25 @@ void setDeltaT(Time& runTime, scalar maxCo, scalar coNum, scalar maxDeltaT)
 
 std::unique_ptr<MeshAdapter> createMesh(const NeoFOAM::Executor& exec, const Time& runTime)
 {
-    word regionName(polyMesh::defaultRegion);
+    return createMesh(exec, runTime, polyMesh::defaultRegion);
+}
+
+std::unique_ptr<MeshAdapter>
+createMesh(const NeoFOAM::Executor& exec, const Time& runTime, const word& regionName)
+{
+    if (regionName != polyMesh::defaultRegion)
+    {
+        Info << "Create mesh " << regionName << " for time = " << runTime.timeName() << nl;
+    }
+    readHugePagePolicy(runTime.controlDict());
+    readMeshConversion(runTime.controlDict());
     IOobject io(regionName, runTime.timeName(), runTime, IOobject::MUST_READ);
-    return std::make_unique<MeshAdapter>(exec, io);
+    auto meshPtr = std::make_unique<MeshAdapter>(exec, io);
+    if (hugePagePolicy() != HugePagePolicy::none)
+    {
+        Info << hugePageReport() << endl;
+    }
+    return meshPtr;
 }
 
 std::unique_ptr<fvMesh> createMesh(const Time& runTime)
@@ -63,9 +135,8 @@ std::unique_ptr<fvMesh> createMesh(const Time& runTime)
     return meshPtr;
 }
 
-NeoFOAM::Executor createExecutor(const dictionary& dict)
+NeoFOAM::Executor createExecutor(const word& execName)
 {
-    auto execName = dict.get<Foam::word>("executor");
     Foam::Info << "Creating Executor: " << execName << Foam::endl;
     if (execName == "Serial")
     {
@@ -83,10 +154,32 @@ NeoFOAM::Executor createExecutor(const dictionary& dict)
         return NeoFOAM::GPUExecutor();
     }
     Foam::FatalError << "unknown Executor: " << execName << Foam::nl
-                     << "Available executors: Serial, CPU, GPU" << Foam::nl
+                     << "Available executors: Serial, CPU, GPU, auto" << Foam::nl
                      << Foam::abort(Foam::FatalError);
 
     return NeoFOAM::SerialExecutor();
 }
 
+NeoFOAM::Executor createExecutor(const dictionary& dict)
+{
+    auto execName = dict.get<Foam::word>("executor");
+    if (execName == "auto")
+    {
+        Foam::FatalError << "executor auto requires the mesh for the calibration runs" << Foam::nl
+                         << "use createExecutor(runTime) instead" << Foam::nl
+                         << Foam::abort(Foam::FatalError);
+    }
+    return createExecutor(execName);
+}
+
+NeoFOAM::Executor createExecutor(const Time& runTime)
+{
+    auto execName = runTime.controlDict().get<Foam::word>("executor");
+    if (execName == "auto")
+    {
+        return autoSelectExecutor(runTime);
+    }
+    return createExecutor(execName);
+}
+
 }
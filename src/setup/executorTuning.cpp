@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "NeoFOAM/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/operators/gaussGreenDiv.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/operators/gaussGreenGrad.hpp"
+#include "NeoFOAM/core/input.hpp"
+
+#include "FoamAdapter/setup.hpp"
+#include "FoamAdapter/readers.hpp"
+#include "FoamAdapter/setup/executorTuning.hpp"
+#include "FoamAdapter/profiling/kernelProfiler.hpp"
+
+#include "IFstream.H"
+#include "OFstream.H"
+
+namespace Foam
+{
+
+namespace
+{
+
+template<typename Kernel>
+scalar medianRunTime(const label nRepetitions, Kernel kernel)
+{
+    // warm up, e.g. first touch and kernel compilation
+    kernel();
+    Kokkos::fence();
+
+    std::vector<scalar> times;
+    for (label i = 0; i < nRepetitions; i++)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        kernel();
+        Kokkos::fence();
+        auto end = std::chrono::high_resolution_clock::now();
+        times.push_back(std::chrono::duration<scalar>(end - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+// executors with distinct execution spaces, named as in the controlDict
+std::vector<word> candidateExecutors()
+{
+    std::vector<word> candidates {"Serial"};
+    if constexpr (!std::is_same_v<Kokkos::DefaultHostExecutionSpace, Kokkos::Serial>)
+    {
+        candidates.push_back("CPU");
+    }
+    if constexpr (!std::is_same_v<Kokkos::DefaultExecutionSpace, Kokkos::DefaultHostExecutionSpace>)
+    {
+        candidates.push_back("GPU");
+    }
+    return candidates;
+}
+
+fileName defaultCacheFile()
+{
+    fileName cacheDir = getEnv("XDG_CACHE_HOME");
+    if (cacheDir.empty())
+    {
+        cacheDir = home()/".cache";
+    }
+    return cacheDir/"FoamAdapter"/"executorCache";
+}
+
+}
+
+word executorCacheKey(const fvMesh& mesh)
+{
+    std::ostringstream key;
+    key << hostName() << "_" << Kokkos::DefaultHostExecutionSpace().concurrency() << "_"
+        << Pstream::nProcs() << "_" << std::hex << computeMeshHash(mesh);
+    return word::validate(key.str());
+}
+
+ExecutorCalibration calibrateExecutor(
+    const NeoFOAM::Executor& exec,
+    const fvMesh& mesh,
+    const label nRepetitions,
+    KernelProfiler* profiler
+)
+{
+    namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+    ExecutorCalibration result;
+
+    NeoFOAM::UnstructuredMesh nfMesh = readOpenFOAMMesh(exec, mesh);
+
+    const word instance = mesh.time().timeName();
+    volScalarField ofT(
+        IOobject("calibrationT", instance, mesh, IOobject::NO_READ, IOobject::NO_WRITE, false),
+        mesh,
+        dimensionedScalar(dimless, 0.0)
+    );
+    ofT.primitiveFieldRef() = mag(mesh.C().primitiveField());
+    ofT.correctBoundaryConditions();
+
+    volVectorField ofGradT(
+        IOobject("calibrationGradT", instance, mesh, IOobject::NO_READ, IOobject::NO_WRITE, false),
+        mesh,
+        dimensionedVector(dimless, Zero)
+    );
+
+    surfaceScalarField ofPhi(
+        IOobject("calibrationPhi", instance, mesh, IOobject::NO_READ, IOobject::NO_WRITE, false),
+        mesh.magSf()
+    );
+
+    auto nfT = constructFrom(exec, nfMesh, ofT);
+    auto nfDivT = constructFrom(exec, nfMesh, ofT);
+    auto nfGradT = constructFrom(exec, nfMesh, ofGradT);
+    auto nfPhi = constructSurfaceField(exec, nfMesh, ofPhi);
+    auto nfSurfT = constructSurfaceField(exec, nfMesh, ofPhi);
+
+    NeoFOAM::Input interpolationScheme = NeoFOAM::TokenList({std::string("linear")});
+    fvcc::SurfaceInterpolation interp(
+        exec, nfMesh, fvcc::SurfaceInterpolationFactory::create(exec, nfMesh, interpolationScheme)
+    );
+    fvcc::GaussGreenDiv div(exec, nfMesh, NeoFOAM::TokenList({std::string("linear")}));
+    fvcc::GaussGreenGrad grad(exec, nfMesh);
+
+    auto interpolationKernel = [&]() { interp.interpolate(nfT, nfSurfT); };
+    auto divKernel = [&]() { div.div(nfDivT, nfPhi, nfT); };
+    auto gradKernel = [&]() { grad.grad(nfT, nfGradT); };
+    auto bcUpdateKernel = [&]() { nfT.correctBoundaryConditions(); };
+
+    result.interpolation = medianRunTime(nRepetitions, interpolationKernel);
+    result.div = medianRunTime(nRepetitions, divKernel);
+    result.grad = medianRunTime(nRepetitions, gradKernel);
+    result.bcUpdate = medianRunTime(nRepetitions, bcUpdateKernel);
+
+    if (profiler)
+    {
+        const auto costs = operatorCosts(mesh);
+        profiler->measure(
+            "interpolation", costs.at("interpolation"), interpolationKernel, nRepetitions
+        );
+        profiler->measure("div", costs.at("div"), divKernel, nRepetitions);
+        profiler->measure("grad", costs.at("grad"), gradKernel, nRepetitions);
+        profiler->measure("bcUpdate", costs.at("bcUpdate"), bcUpdateKernel, nRepetitions);
+    }
+
+    // the slowest rank determines the time step
+    reduce(result.interpolation, maxOp<scalar>());
+    reduce(result.div, maxOp<scalar>());
+    reduce(result.grad, maxOp<scalar>());
+    reduce(result.bcUpdate, maxOp<scalar>());
+
+    return result;
+}
+
+NeoFOAM::Executor autoSelectExecutor(const Time& runTime)
+{
+    return autoSelectExecutor(runTime, runTime.controlDict().subOrEmptyDict("executorTuning"));
+}
+
+NeoFOAM::Executor autoSelectExecutor(const Time& runTime, const dictionary& tuningDict)
+{
+    const label nRepetitions = max(tuningDict.getOrDefault<label>("repetitions", 5), 1);
+    const bool useCache = tuningDict.getOrDefault<bool>("cache", true);
+    fileName cacheFile = tuningDict.getOrDefault<fileName>("cacheFile", defaultCacheFile());
+    cacheFile.expand();
+
+    Info << "Selecting executor automatically" << endl;
+    std::unique_ptr<fvMesh> meshPtr = createMesh(runTime);
+    const word key = executorCacheKey(*meshPtr);
+
+    // the cache is handled by the master so all ranks take the same decision
+    dictionary cache;
+    word cachedExecutor;
+    if (useCache && Pstream::master() && isFile(cacheFile))
+    {
+        IFstream is(cacheFile);
+        cache = dictionary(is);
+        const dictionary* cached = cache.findDict(key);
+        if (cached)
+        {
+            cachedExecutor = cached->get<word>("executor");
+        }
+    }
+    Pstream::broadcast(cachedExecutor);
+    if (!cachedExecutor.empty())
+    {
+        Info << "Using cached executor " << cachedExecutor << " from " << cacheFile << endl;
+        return createExecutor(cachedExecutor);
+    }
+
+    std::vector<ExecutorCalibration> calibrations;
+    for (const auto& execName : candidateExecutors())
+    {
+        calibrations.push_back(
+            calibrateExecutor(createExecutor(execName), *meshPtr, nRepetitions)
+        );
+        calibrations.back().executor = execName;
+        const auto& c = calibrations.back();
+        Info << "    " << c.executor << ": interpolation " << c.interpolation << " s, div " << c.div
+             << " s, grad " << c.grad << " s, bcUpdate " << c.bcUpdate << " s, total "
+             << c.total() << " s" << endl;
+    }
+
+    const auto best = std::min_element(
+        calibrations.begin(),
+        calibrations.end(),
+        [](const auto& a, const auto& b) { return a.total() < b.total(); }
+    );
+
+    const label nCells = returnReduce(meshPtr->nCells(), sumOp<label>());
+    if (useCache && Pstream::master())
+    {
+        dictionary entry;
+        entry.add("executor", best->executor);
+        entry.add("nCells", nCells);
+        entry.add("interpolation", best->interpolation);
+        entry.add("div", best->div);
+        entry.add("grad", best->grad);
+        entry.add("bcUpdate", best->bcUpdate);
+        cache.set(key, entry);
+
+        mkDir(cacheFile.path());
+        OFstream os(cacheFile);
+        cache.writeEntries(os);
+    }
+
+    return createExecutor(best->executor);
+}
+
+} // namespace Foam
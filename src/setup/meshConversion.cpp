@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <algorithm>
+
+#include "FoamAdapter/setup/meshConversion.hpp"
+#include "FoamAdapter/conversion/convert.hpp"
+#include "FoamAdapter/meshAdapter.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+size_t chunkSize_ = 0;
+
+bool releaseFoamStorage_ = false;
+
+// patch and patch local index of the flattened boundary faces
+struct BoundaryFace
+{
+    label patchi;
+    label facei;
+};
+
+}
+
+void setMeshConversionChunkSize(const size_t bytes) { chunkSize_ = bytes; }
+
+size_t meshConversionChunkSize() { return chunkSize_; }
+
+void setReleaseFoamStorage(const bool release) { releaseFoamStorage_ = release; }
+
+bool releaseFoamStorage() { return releaseFoamStorage_; }
+
+void readMeshConversion(const dictionary& controlDict)
+{
+    const dictionary dict = controlDict.subOrEmptyDict("meshConversion");
+    const label chunkSize = dict.getOrDefault<label>("chunkSize", 0);
+    if (chunkSize < 0)
+    {
+        FatalIOErrorInFunction(dict) << "chunkSize " << chunkSize << " is negative"
+                                     << exit(FatalIOError);
+    }
+    setMeshConversionChunkSize(chunkSize);
+    setReleaseFoamStorage(dict.getOrDefault<bool>("releaseFoamStorage", false));
+}
+
+NeoFOAM::UnstructuredMesh
+readOpenFOAMMeshChunked(const NeoFOAM::Executor& exec, const fvMesh& mesh, const size_t chunkBytes)
+{
+    using detail::uploadChunked;
+
+    const int32_t nCells = mesh.nCells();
+    const int32_t nInternalFaces = mesh.nInternalFaces();
+    const int32_t nBoundaryFaces = computeNBoundaryFaces(mesh);
+    const int32_t nBoundaries = mesh.boundary().size();
+    const int32_t nFaces = mesh.nFaces();
+    const std::vector<NeoFOAM::localIdx> offset = computeOffset(mesh);
+
+    // evaluate the lazily computed geometry before it is accessed concurrently
+    const pointField& points = mesh.points();
+    const vectorField& faceAreas = mesh.faceAreas();
+    const vectorField& faceCentres = mesh.faceCentres();
+    const vectorField& cellCentres = mesh.cellCentres();
+    const scalarField& cellVolumes = mesh.cellVolumes();
+    const labelList& owner = mesh.faceOwner();
+    const labelList& neighbour = mesh.faceNeighbour();
+    const fvBoundaryMesh& bMesh = mesh.boundary();
+    const auto& weights = mesh.weights().boundaryField();
+    const auto& deltaCoeffs = mesh.deltaCoeffs().boundaryField();
+
+    // delta of coupled patches depends on the neighbour side, i.e. is computed per patch
+    PtrList<vectorField> coupledDelta(nBoundaries);
+    forAll(bMesh, patchi)
+    {
+        if (bMesh[patchi].coupled())
+        {
+            coupledDelta.set(patchi, new vectorField(bMesh[patchi].delta()));
+        }
+    }
+
+    auto boundaryFace = [&](const size_t i)
+    {
+        const auto next = std::upper_bound(offset.begin(), offset.end(), NeoFOAM::localIdx(i));
+        const label patchi = next - offset.begin() - 1;
+        return BoundaryFace {patchi, label(i - offset[patchi])};
+    };
+    auto meshFace = [&](const BoundaryFace& bf)
+    { return bMesh[bf.patchi].start() + bf.facei; };
+
+    const size_t nb = nBoundaryFaces;
+    NeoFOAM::BoundaryMesh nfBMesh(
+        exec,
+        uploadChunked<NeoFOAM::label>(
+            exec,
+            nb,
+            chunkBytes,
+            [&](const size_t i)
+            {
+                const auto bf = boundaryFace(i);
+                return NeoFOAM::label(bMesh[bf.patchi].faceCells()[bf.facei]);
+            }
+        ),
+        uploadChunked<NeoFOAM::Vector>(
+            exec,
+            nb,
+            chunkBytes,
+            [&](const size_t i) { return convert(faceCentres[meshFace(boundaryFace(i))]); }
+        ),
+        uploadChunked<NeoFOAM::Vector>(
+            exec,
+            nb,
+            chunkBytes,
+            [&](const size_t i)
+            {
+                const auto bf = boundaryFace(i);
+                return convert(cellCentres[bMesh[bf.patchi].faceCells()[bf.facei]]);
+            }
+        ),
+        uploadChunked<NeoFOAM::Vector>(
+            exec,
+            nb,
+            chunkBytes,
+            [&](const size_t i) { return convert(faceAreas[meshFace(boundaryFace(i))]); }
+        ),
+        uploadChunked<NeoFOAM::scalar>(
+            exec,
+            nb,
+            chunkBytes,
+            [&](const size_t i) { return mag(faceAreas[meshFace(boundaryFace(i))]); }
+        ),
+        uploadChunked<NeoFOAM::Vector>(
+            exec,
+            nb,
+            chunkBytes,
+            [&](const size_t i)
+            {
+                const vector& sf = faceAreas[meshFace(boundaryFace(i))];
+                return convert(sf / mag(sf));
+            }
+        ),
+        uploadChunked<NeoFOAM::Vector>(
+            exec,
+            nb,
+            chunkBytes,
+            [&](const size_t i)
+            {
+                const auto bf = boundaryFace(i);
+                if (coupledDelta.set(bf.patchi))
+                {
+                    return convert(coupledDelta[bf.patchi][bf.facei]);
+                }
+                // fvPatch::delta of non-coupled patches is the normal projection of Cf - Cn
+                const label facei = meshFace(bf);
+                const label celli = bMesh[bf.patchi].faceCells()[bf.facei];
+                const vector nf = faceAreas[facei] / mag(faceAreas[facei]);
+                return convert(nf * (nf & (faceCentres[facei] - cellCentres[celli])));
+            }
+        ),
+        uploadChunked<NeoFOAM::scalar>(
+            exec,
+            nb,
+            chunkBytes,
+            [&](const size_t i)
+            {
+                const auto bf = boundaryFace(i);
+                return weights[bf.patchi][bf.facei];
+            }
+        ),
+        uploadChunked<NeoFOAM::scalar>(
+            exec,
+            nb,
+            chunkBytes,
+            [&](const size_t i)
+            {
+                const auto bf = boundaryFace(i);
+                return deltaCoeffs[bf.patchi][bf.facei];
+            }
+        ),
+        offset
+    );
+
+    return NeoFOAM::UnstructuredMesh(
+        uploadChunked<NeoFOAM::Vector>(
+            exec, points.size(), chunkBytes, [&](const size_t i) { return convert(points[i]); }
+        ),
+        uploadChunked<NeoFOAM::scalar>(
+            exec, nCells, chunkBytes, [&](const size_t i) { return cellVolumes[i]; }
+        ),
+        uploadChunked<NeoFOAM::Vector>(
+            exec, nCells, chunkBytes, [&](const size_t i) { return convert(cellCentres[i]); }
+        ),
+        uploadChunked<NeoFOAM::Vector>(
+            exec, nFaces, chunkBytes, [&](const size_t i) { return convert(faceAreas[i]); }
+        ),
+        uploadChunked<NeoFOAM::Vector>(
+            exec, nFaces, chunkBytes, [&](const size_t i) { return convert(faceCentres[i]); }
+        ),
+        uploadChunked<NeoFOAM::scalar>(
+            exec, nFaces, chunkBytes, [&](const size_t i) { return mag(faceAreas[i]); }
+        ),
+        uploadChunked<NeoFOAM::label>(
+            exec, nFaces, chunkBytes, [&](const size_t i) { return NeoFOAM::label(owner[i]); }
+        ),
+        uploadChunked<NeoFOAM::label>(
+            exec,
+            nInternalFaces,
+            chunkBytes,
+            [&](const size_t i) { return NeoFOAM::label(neighbour[i]); }
+        ),
+        nCells,
+        nInternalFaces,
+        nBoundaryFaces,
+        nBoundaries,
+        nFaces,
+        nfBMesh
+    );
+}
+
+} // namespace Foam
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include "FoamAdapter/setup.hpp"
+#include "FoamAdapter/readers.hpp"
+#include "FoamAdapter/setup/multiRegion.hpp"
+
+#include "IOdictionary.H"
+#include "mappedPatchBase.H"
+
+namespace Foam
+{
+
+std::pair<wordList, HashTable<word>> readRegionProperties(const Time& runTime)
+{
+    IOobject io(
+        "regionProperties",
+        runTime.constant(),
+        runTime,
+        IOobject::MUST_READ,
+        IOobject::NO_WRITE,
+        false
+    );
+
+    wordList names;
+    HashTable<word> types;
+    if (!io.typeHeaderOk<IOdictionary>(true))
+    {
+        names.append(polyMesh::defaultRegion);
+        types.insert(polyMesh::defaultRegion, word::null);
+        return {names, types};
+    }
+
+    IOdictionary props(io);
+    HashTable<wordList> regions;
+    props.readEntry("regions", regions);
+    for (const word& regionType : regions.sortedToc())
+    {
+        for (const word& regionName : regions[regionType])
+        {
+            names.append(regionName);
+            types.insert(regionName, regionType);
+        }
+    }
+    return {names, types};
+}
+
+RegionMeshes::RegionMeshes(const NeoFOAM::Executor& exec, const Time& runTime) : exec_(exec)
+{
+    std::tie(names_, types_) = readRegionProperties(runTime);
+
+    meshes_.resize(names_.size());
+    forAll(names_, regioni)
+    {
+        meshes_.set(regioni, createMesh(exec, runTime, names_[regioni]).release());
+    }
+
+    // the meshes need to be registered before the mapped patches can be evaluated
+    forAll(meshes_, regioni)
+    {
+        const MeshAdapter& mesh = meshes_[regioni];
+        const polyBoundaryMesh& bMesh = mesh.boundaryMesh();
+        const std::vector<NeoFOAM::localIdx> offsets = computeOffset(mesh);
+        forAll(bMesh, patchi)
+        {
+            if (!isA<mappedPatchBase>(bMesh[patchi]))
+            {
+                continue;
+            }
+            const auto& mpp = refCast<const mappedPatchBase>(bMesh[patchi]);
+            if (mpp.mode() != mappedPatchBase::NEARESTPATCHFACE)
+            {
+                WarningInFunction << "patch " << bMesh[patchi].name() << " of region "
+                                  << names_[regioni] << " uses sampleMode "
+                                  << mappedPatchBase::sampleModeNames_[mpp.mode()] << nl
+                                  << "    only nearestPatchFace is converted to an interface"
+                                  << endl;
+                continue;
+            }
+
+            const polyPatch& nbrPatch = mpp.samplePolyPatch();
+            const MeshAdapter& nbrMesh = mesh.time().lookupObject<MeshAdapter>(mpp.sampleRegion());
+            const NeoFOAM::label nbrOffset = computeOffset(nbrMesh)[nbrPatch.index()];
+
+            // send the face indices and processors of the neighbour patch to this patch
+            labelList nbrFaces(identity(nbrPatch.size()));
+            labelList nbrProcs(nbrPatch.size(), Pstream::myProcNo());
+            mpp.distribute(nbrFaces);
+            mpp.distribute(nbrProcs);
+
+            bool remote = false;
+            for (const label proci : nbrProcs)
+            {
+                remote = remote || proci != Pstream::myProcNo();
+            }
+            if (returnReduce(remote, orOp<bool>()))
+            {
+                FatalErrorInFunction << "patch " << bMesh[patchi].name() << " of region "
+                                     << names_[regioni] << " is coupled across processors"
+                                     << nl << "    decompose the regions consistently, e.g. "
+                                     << "with preservePatches" << exit(FatalError);
+            }
+
+            labelList nbrBoundaryFaces(nbrFaces.size());
+            labelList nbrFaceCells(nbrFaces.size());
+            const labelUList& faceCells = nbrPatch.faceCells();
+            forAll(nbrFaces, facei)
+            {
+                nbrBoundaryFaces[facei] = nbrOffset + nbrFaces[facei];
+                nbrFaceCells[facei] = faceCells[nbrFaces[facei]];
+            }
+
+            interfaces_.push_back(RegionInterface {
+                .region = names_[regioni],
+                .patch = bMesh[patchi].name(),
+                .patchi = patchi,
+                .nbrRegion = mpp.sampleRegion(),
+                .nbrPatch = nbrPatch.name(),
+                .nbrPatchi = nbrPatch.index(),
+                .offset = offsets[patchi],
+                .nbrBoundaryFaces = fromFoamField(exec, nbrBoundaryFaces),
+                .nbrFaceCells = fromFoamField(exec, nbrFaceCells)
+            });
+
+            Info << "Coupled " << names_[regioni] << "/" << bMesh[patchi].name() << " to "
+                 << mpp.sampleRegion() << "/" << nbrPatch.name() << endl;
+        }
+    }
+}
+
+wordList RegionMeshes::names(const word& regionType) const
+{
+    wordList result;
+    for (const word& regionName : names_)
+    {
+        if (types_[regionName] == regionType)
+        {
+            result.append(regionName);
+        }
+    }
+    return result;
+}
+
+std::vector<const RegionInterface*> RegionMeshes::interfaces(const word& regionName) const
+{
+    std::vector<const RegionInterface*> result;
+    for (const auto& interface : interfaces_)
+    {
+        if (interface.region == regionName)
+        {
+            result.push_back(&interface);
+        }
+    }
+    return result;
+}
+
+} // namespace Foam
@@ -0,0 +1,530 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <zlib.h>
+
+#include "OSspecific.H"
+
+#include "FoamAdapter/writers/timeSeries.hpp"
+#include "FoamAdapter/meshAdapter.hpp"
+
+namespace Foam
+{
+
+namespace
+{
+
+constexpr char headerMagic[8] = {'N', 'F', 'T', 'S', 'E', 'R', 'I', 'E'};
+constexpr char footerMagic[8] = {'N', 'F', 'T', 'S', 'I', 'N', 'D', 'X'};
+constexpr uint32_t version = 2;
+
+void writeAt(const int fd, const void* data, const size_t nBytes, const uint64_t offset)
+{
+    const char* bytes = static_cast<const char*>(data);
+    size_t written = 0;
+    while (written < nBytes)
+    {
+        const ssize_t n = pwrite(fd, bytes + written, nBytes - written, offset + written);
+        if (n <= 0)
+        {
+            FatalErrorInFunction << "cannot write time series record" << exit(FatalError);
+        }
+        written += n;
+    }
+}
+
+bool readAt(const int fd, void* data, const size_t nBytes, const uint64_t offset)
+{
+    return pread(fd, data, nBytes, offset) == ssize_t(nBytes);
+}
+
+uint32_t checksum(const char* data, const size_t nBytes)
+{
+    return crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const Bytef*>(data), nBytes);
+}
+
+// records start at 8 byte boundaries so they can be used in place from a mapped file
+uint64_t paddedBytes(const uint64_t bytes) { return (bytes + 7) & ~uint64_t(7); }
+
+// checks that the index ends at the footer of a file of size bytes
+bool validFooter(const TimeSeriesFooter& footer, const uint64_t size)
+{
+    if (size < sizeof(TimeSeriesHeader) + sizeof(TimeSeriesFooter))
+    {
+        return false;
+    }
+    const uint64_t footerOffset = size - sizeof(TimeSeriesFooter);
+    return std::memcmp(footer.magic, footerMagic, sizeof(footerMagic)) == 0
+        && footer.indexOffset >= sizeof(TimeSeriesHeader) && footer.indexOffset <= footerOffset
+        && (footerOffset - footer.indexOffset) % sizeof(TimeSeriesIndexEntry) == 0
+        && footer.nRecords == (footerOffset - footer.indexOffset) / sizeof(TimeSeriesIndexEntry);
+}
+
+// checks that the record of the entry lies between the header and the index
+bool validEntry(
+    const TimeSeriesIndexEntry& entry,
+    const uint64_t indexOffset,
+    const uint64_t recordBytes
+)
+{
+    return entry.offset >= sizeof(TimeSeriesHeader) + sizeof(TimeSeriesRecordHeader)
+        && entry.offset <= indexOffset && entry.bytes <= indexOffset - entry.offset
+        && (entry.compressed == 1 ? entry.bytes > 0 : entry.bytes == recordBytes);
+}
+
+// reads the index of a completely written file, false if the footer or an entry is invalid
+bool readIndex(
+    const int fd,
+    const uint64_t size,
+    const uint64_t recordBytes,
+    std::vector<TimeSeriesIndexEntry>& index,
+    uint64_t& dataEnd
+)
+{
+    TimeSeriesFooter footer {};
+    if (size < sizeof(footer) || !readAt(fd, &footer, sizeof(footer), size - sizeof(footer))
+        || !validFooter(footer, size))
+    {
+        return false;
+    }
+    index.resize(footer.nRecords);
+    if (!readAt(fd, index.data(), index.size() * sizeof(TimeSeriesIndexEntry), footer.indexOffset))
+    {
+        return false;
+    }
+    for (const TimeSeriesIndexEntry& entry : index)
+    {
+        if (!validEntry(entry, footer.indexOffset, recordBytes))
+        {
+            return false;
+        }
+    }
+    dataEnd = footer.indexOffset;
+    return true;
+}
+
+// rebuilds the index from the record headers, e.g. after an interrupted flush. The records end
+// at the first header which is incomplete, fails its checksum or does not advance in time
+void recoverIndex(
+    const int fd,
+    const uint64_t size,
+    const uint64_t recordBytes,
+    std::vector<TimeSeriesIndexEntry>& index,
+    uint64_t& dataEnd
+)
+{
+    index.clear();
+    uint64_t offset = sizeof(TimeSeriesHeader);
+    TimeSeriesRecordHeader record {};
+    std::vector<char> data;
+    while (offset + sizeof(record) <= size && readAt(fd, &record, sizeof(record), offset))
+    {
+        const uint64_t dataOffset = offset + sizeof(record);
+        const bool validSize = record.compressed == 1 ? record.bytes > 0
+                             : record.compressed == 0 ? record.bytes == recordBytes
+                                                      : false;
+        if (!validSize || record.bytes > size - dataOffset
+            || (!index.empty() && record.time <= index.back().time))
+        {
+            break;
+        }
+        data.resize(record.bytes);
+        if (!readAt(fd, data.data(), data.size(), dataOffset)
+            || checksum(data.data(), data.size()) != record.checksum)
+        {
+            break;
+        }
+        index.push_back({record.time, dataOffset, record.bytes, record.compressed, 0});
+        offset = dataOffset + paddedBytes(record.bytes);
+    }
+    dataEnd = offset;
+}
+
+}
+
+TimeSeriesWriter::State::~State()
+{
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+}
+
+void TimeSeriesWriter::State::flush()
+{
+    std::lock_guard<std::mutex> writeLock(writeMutex);
+    std::vector<Record> pending;
+    {
+        std::lock_guard<std::mutex> recordsLock(recordsMutex);
+        pending.swap(records);
+    }
+    if (pending.empty())
+    {
+        return;
+    }
+
+    for (auto& record : pending)
+    {
+        // a restart overwrites the records from its first time on
+        while (!index.empty() && index.back().time >= record.time)
+        {
+            dataEnd = index.back().offset - sizeof(TimeSeriesRecordHeader);
+            index.pop_back();
+        }
+
+        TimeSeriesIndexEntry entry {
+            record.time, dataEnd + sizeof(TimeSeriesRecordHeader), record.data.size(), 0, 0
+        };
+        std::vector<char> compressed;
+        if (compress)
+        {
+            uLongf nBytes = compressBound(record.data.size());
+            compressed.resize(nBytes);
+            const int status = compress2(
+                reinterpret_cast<Bytef*>(compressed.data()),
+                &nBytes,
+                reinterpret_cast<const Bytef*>(record.data.data()),
+                record.data.size(),
+                Z_BEST_SPEED
+            );
+            if (status == Z_OK && nBytes < record.data.size())
+            {
+                compressed.resize(nBytes);
+                entry.bytes = nBytes;
+                entry.compressed = 1;
+            }
+        }
+        const char* bytes = entry.compressed ? compressed.data() : record.data.data();
+        const TimeSeriesRecordHeader recordHeader {
+            entry.time, entry.bytes, entry.compressed, checksum(bytes, entry.bytes)
+        };
+        writeAt(fd, &recordHeader, sizeof(recordHeader), dataEnd);
+        writeAt(fd, bytes, entry.bytes, entry.offset);
+        dataEnd = entry.offset + paddedBytes(entry.bytes);
+        index.push_back(entry);
+    }
+
+    TimeSeriesFooter footer {dataEnd, index.size(), {}};
+    std::memcpy(footer.magic, footerMagic, sizeof(footerMagic));
+    const size_t indexBytes = index.size() * sizeof(TimeSeriesIndexEntry);
+    std::vector<char> tail(indexBytes + sizeof(footer));
+    std::memcpy(tail.data(), index.data(), indexBytes);
+    std::memcpy(tail.data() + indexBytes, &footer, sizeof(footer));
+    writeAt(fd, tail.data(), tail.size(), dataEnd);
+    if (ftruncate(fd, dataEnd + tail.size()) != 0)
+    {
+        FatalErrorInFunction << "cannot truncate time series file" << exit(FatalError);
+    }
+}
+
+TimeSeriesWriter::TimeSeriesWriter(
+    const fileName& file,
+    const word& name,
+    const label nComponents,
+    const label nValues,
+    const uint64_t meshHash,
+    const bool compress,
+    WorkStealingPool* pool
+)
+    : file_(file)
+    , recordBytes_(nComponents * nValues * sizeof(NeoFOAM::scalar))
+    , state_(std::make_shared<State>())
+    , pool_(pool)
+{
+    mkDir(file.path());
+    state_->compress = compress;
+    state_->fd = open(file.c_str(), O_RDWR | O_CREAT, 0644);
+    if (state_->fd < 0)
+    {
+        FatalErrorInFunction << "cannot open time series file " << file << exit(FatalError);
+    }
+
+    TimeSeriesHeader header {};
+    std::memcpy(header.magic, headerMagic, sizeof(headerMagic));
+    header.version = version;
+    header.nComponents = nComponents;
+    header.nValues = nValues;
+    header.meshHash = meshHash;
+    std::strncpy(header.name, name.c_str(), sizeof(header.name) - 1);
+
+    // continue an existing file of the same field and mesh
+    TimeSeriesHeader existing {};
+    struct stat info;
+    fstat(state_->fd, &info);
+    const uint64_t size = info.st_size;
+    const bool continued = size >= sizeof(header)
+                        && readAt(state_->fd, &existing, sizeof(existing), 0)
+                        && std::memcmp(&existing, &header, sizeof(header)) == 0;
+    if (continued)
+    {
+        if (!readIndex(state_->fd, size, recordBytes_, state_->index, state_->dataEnd))
+        {
+            recoverIndex(state_->fd, size, recordBytes_, state_->index, state_->dataEnd);
+            WarningInFunction << "the index of the time series file " << file
+                              << " is incomplete, continuing after the "
+                              << state_->index.size() << " intact records" << endl;
+        }
+    }
+    else
+    {
+        if (info.st_size > 0)
+        {
+            WarningInFunction << "overwriting the time series file " << file
+                              << " of a different field or mesh" << endl;
+        }
+        if (ftruncate(state_->fd, 0) != 0)
+        {
+            FatalErrorInFunction << "cannot truncate time series file " << file
+                                 << exit(FatalError);
+        }
+        writeAt(state_->fd, &header, sizeof(header), 0);
+        state_->dataEnd = sizeof(header);
+    }
+}
+
+TimeSeriesWriter::~TimeSeriesWriter() { state_->flush(); }
+
+template<typename ValueType>
+void TimeSeriesWriter::append(const scalar time, const NeoFOAM::Field<ValueType>& values)
+{
+    if (values.size() * sizeof(ValueType) != recordBytes_)
+    {
+        FatalErrorInFunction << "the values do not match the time series file " << file_
+                             << exit(FatalError);
+    }
+    auto hostValues = values.copyToHost();
+    std::vector<char> data(recordBytes_);
+    std::memcpy(data.data(), hostValues.data(), recordBytes_);
+    appendRecord(time, std::move(data));
+}
+
+void TimeSeriesWriter::appendRecord(const scalar time, std::vector<char> data)
+{
+    {
+        std::lock_guard<std::mutex> recordsLock(state_->recordsMutex);
+        state_->records.push_back({time, std::move(data)});
+    }
+    if (pool_)
+    {
+        pool_->submit([state = state_]() { state->flush(); });
+    }
+    else
+    {
+        state_->flush();
+    }
+}
+
+void TimeSeriesWriter::flush() { state_->flush(); }
+
+template void
+TimeSeriesWriter::append<NeoFOAM::scalar>(const scalar, const NeoFOAM::Field<NeoFOAM::scalar>&);
+
+template void
+TimeSeriesWriter::append<NeoFOAM::Vector>(const scalar, const NeoFOAM::Field<NeoFOAM::Vector>&);
+
+
+TimeSeriesReader::TimeSeriesReader(const fileName& file) : file_(file)
+{
+    fd_ = open(file.c_str(), O_RDONLY);
+    struct stat info;
+    if (fd_ < 0 || fstat(fd_, &info) != 0)
+    {
+        FatalErrorInFunction << "cannot open time series file " << file << exit(FatalError);
+    }
+    size_ = info.st_size;
+    if (size_ < sizeof(TimeSeriesHeader) + sizeof(TimeSeriesFooter))
+    {
+        FatalErrorInFunction << "truncated time series file " << file << exit(FatalError);
+    }
+    void* mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (mapped == MAP_FAILED)
+    {
+        FatalErrorInFunction << "cannot map time series file " << file << exit(FatalError);
+    }
+    data_ = static_cast<const char*>(mapped);
+
+    header_ = reinterpret_cast<const TimeSeriesHeader*>(data_);
+    const auto* footer =
+        reinterpret_cast<const TimeSeriesFooter*>(data_ + size_ - sizeof(TimeSeriesFooter));
+    if (std::memcmp(header_->magic, headerMagic, sizeof(headerMagic)) != 0
+        || std::memcmp(footer->magic, footerMagic, sizeof(footerMagic)) != 0
+        || header_->version != version)
+    {
+        FatalErrorInFunction << file << " is not a time series file of version " << version
+                             << exit(FatalError);
+    }
+
+    // the offsets of a truncated or partially written file may point outside the mapping
+    const uint64_t maxComponents = 9;
+    if (header_->nComponents < 1 || header_->nComponents > maxComponents
+        || header_->nValues
+               > std::numeric_limits<uint64_t>::max() / (maxComponents * sizeof(NeoFOAM::scalar))
+        || !validFooter(*footer, size_))
+    {
+        FatalErrorInFunction << "invalid header or index of the time series file " << file
+                             << exit(FatalError);
+    }
+    index_ = std::span<const TimeSeriesIndexEntry>(
+        reinterpret_cast<const TimeSeriesIndexEntry*>(data_ + footer->indexOffset),
+        footer->nRecords
+    );
+    const uint64_t recordBytes =
+        header_->nValues * header_->nComponents * sizeof(NeoFOAM::scalar);
+    for (size_t recordi = 0; recordi < index_.size(); recordi++)
+    {
+        if (!validEntry(index_[recordi], footer->indexOffset, recordBytes))
+        {
+            FatalErrorInFunction << "record " << recordi << " of the time series file " << file
+                                 << " lies outside its data" << exit(FatalError);
+        }
+    }
+}
+
+TimeSeriesReader::~TimeSeriesReader()
+{
+    if (data_)
+    {
+        munmap(const_cast<char*>(data_), size_);
+    }
+    if (fd_ >= 0)
+    {
+        close(fd_);
+    }
+}
+
+label TimeSeriesReader::findRecord(const scalar time) const
+{
+    auto it = std::lower_bound(
+        index_.begin(),
+        index_.end(),
+        time,
+        [](const TimeSeriesIndexEntry& entry, const scalar t) { return entry.time < t; }
+    );
+    if (it == index_.end())
+    {
+        return index_.size() - 1;
+    }
+    if (it != index_.begin() && time - (it - 1)->time < it->time - time)
+    {
+        it--;
+    }
+    return it - index_.begin();
+}
+
+template<typename ValueType>
+std::span<const ValueType>
+TimeSeriesReader::values(const label recordi, std::vector<ValueType>& buffer) const
+{
+    const size_t nValues =
+        header_->nValues * header_->nComponents * sizeof(NeoFOAM::scalar) / sizeof(ValueType);
+    const TimeSeriesIndexEntry& entry = index_[recordi];
+    const char* record = data_ + entry.offset;
+    if (!entry.compressed)
+    {
+        return std::span<const ValueType>(reinterpret_cast<const ValueType*>(record), nValues);
+    }
+
+    buffer.resize(nValues);
+    uLongf nBytes = nValues * sizeof(ValueType);
+    if (uncompress(
+            reinterpret_cast<Bytef*>(buffer.data()),
+            &nBytes,
+            reinterpret_cast<const Bytef*>(record),
+            entry.bytes
+        )
+        != Z_OK)
+    {
+        FatalErrorInFunction << "cannot uncompress record " << recordi << " of " << file_
+                             << exit(FatalError);
+    }
+    return std::span<const ValueType>(buffer.data(), nValues);
+}
+
+template<typename ValueType>
+NeoFOAM::Field<ValueType>
+TimeSeriesReader::read(const NeoFOAM::Executor& exec, const label recordi) const
+{
+    if (sizeof(ValueType) != header_->nComponents * sizeof(NeoFOAM::scalar))
+    {
+        FatalErrorInFunction << "the time series " << file_ << " has " << header_->nComponents
+                             << " components" << exit(FatalError);
+    }
+    std::vector<ValueType> buffer;
+    const auto recordValues = values(recordi, buffer);
+    return NeoFOAM::Field<ValueType>(exec, recordValues.data(), recordValues.size());
+}
+
+template std::span<const NeoFOAM::scalar>
+TimeSeriesReader::values<NeoFOAM::scalar>(const label, std::vector<NeoFOAM::scalar>&) const;
+
+template std::span<const NeoFOAM::Vector>
+TimeSeriesReader::values<NeoFOAM::Vector>(const label, std::vector<NeoFOAM::Vector>&) const;
+
+template NeoFOAM::Field<NeoFOAM::scalar>
+TimeSeriesReader::read<NeoFOAM::scalar>(const NeoFOAM::Executor&, const label) const;
+
+template NeoFOAM::Field<NeoFOAM::Vector>
+TimeSeriesReader::read<NeoFOAM::Vector>(const NeoFOAM::Executor&, const label) const;
+
+
+TimeSeriesOutput::TimeSeriesOutput(
+    const fvMesh& mesh,
+    const dictionary& dict,
+    WorkStealingPool* pool
+)
+    : mesh_(mesh)
+    , pool_(pool)
+    , fields_()
+    , interval_(1)
+    , compress_(false)
+    , meshHash_(0)
+    , writers_()
+{
+    const dictionary timeSeriesDict = dict.subOrEmptyDict("timeSeries");
+    fields_ = timeSeriesDict.getOrDefault<wordList>("fields", wordList());
+    interval_ = max(timeSeriesDict.getOrDefault<label>("interval", 1), 1);
+    compress_ = timeSeriesDict.getOrDefault<bool>("compression", false);
+    if (!fields_.empty())
+    {
+        meshHash_ = computeMeshHash(mesh);
+    }
+}
+
+template<typename ValueType>
+void TimeSeriesOutput::write(const fvcc::VolumeField<ValueType>& field)
+{
+    const Time& time = mesh_.time();
+    if (!fields_.found(field.name) || time.timeIndex() % interval_ != 0)
+    {
+        return;
+    }
+    auto& writer = writers_[field.name];
+    if (!writer)
+    {
+        writer = std::make_unique<TimeSeriesWriter>(
+            time.path() / "timeSeries" / field.name + ".nfts",
+            field.name,
+            sizeof(ValueType) / sizeof(NeoFOAM::scalar),
+            mesh_.nCells(),
+            meshHash_,
+            compress_,
+            pool_
+        );
+    }
+    writer->append(time.value(), field.internalField());
+}
+
+template void TimeSeriesOutput::write<NeoFOAM::scalar>(const fvcc::VolumeField<NeoFOAM::scalar>&);
+
+template void TimeSeriesOutput::write<NeoFOAM::Vector>(const fvcc::VolumeField<NeoFOAM::Vector>&);
+
+} // namespace Foam
@@ -15,6 +15,7 @@
 
 #include "FoamAdapter/FoamAdapter.hpp"
 #include "FoamAdapter/readers/foamDictionary.hpp"
+#include "FoamAdapter/ensemble/ensembleField.hpp"
 
 #define namespaceFoam
 #include "fvCFD.H"
@@ -192,3 +193,90 @@ TEST_CASE("Advection Equation")
         Info << "End\n" << endl;
     }
 }
+
+TEST_CASE("Ensemble upwind advection")
+{
+    Foam::Time& runTime = *timePtr;
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    SECTION("batched members equal single member steps with " + execName)
+    {
+        runTime.setTime(0.0, 0);
+
+        std::unique_ptr<Foam::MeshAdapter> meshAdapterPtr = Foam::createMesh(exec, runTime);
+        Foam::MeshAdapter& mesh = *meshAdapterPtr;
+        NeoFOAM::UnstructuredMesh& nfMesh = mesh.nfMesh();
+
+        // the test case uses Gauss upwind and zero gradient boundaries as advanceUpwind
+        NeoFOAM::Dictionary fvSchemesDict = Foam::readFoamDictionary(mesh.schemesDict());
+        fvSchemesDict.get<NeoFOAM::Dictionary>("ddtSchemes").insert(
+            "type", std::string("forwardEuler")
+        );
+        NeoFOAM::Dictionary fvSolutionDict = Foam::readFoamDictionary(mesh.solutionDict());
+
+        Foam::volScalarField T(
+            Foam::IOobject("T", runTime.timeName(), mesh, Foam::IOobject::MUST_READ), mesh
+        );
+        Foam::volVectorField U(
+            Foam::IOobject("U", runTime.timeName(), mesh, Foam::IOobject::MUST_READ), mesh
+        );
+        Foam::surfaceScalarField phi("phi", Foam::linearInterpolate(U) & mesh.Sf());
+        initFields(T, U, phi);
+
+        // members with different initial values and flux scales, including a reversed flow
+        const std::vector<NeoFOAM::scalar> scales {1.0, 0.5, -1.0};
+        const NeoFOAM::label nMembers = scales.size();
+        NeoFOAM::Field<NeoFOAM::scalar> fluxScale(exec, scales);
+
+        Foam::EnsembleField ensembleT(exec, nfMesh, nMembers);
+        std::vector<fvcc::VolumeField<NeoFOAM::scalar>> nfT;
+        std::vector<fvcc::SurfaceField<NeoFOAM::scalar>> nfPhi;
+        for (NeoFOAM::label memberi = 0; memberi < nMembers; memberi++)
+        {
+            Foam::volScalarField memberT("T" + Foam::name(memberi), (memberi + 1.0) * T);
+            nfT.push_back(Foam::constructFrom(exec, nfMesh, memberT));
+            nfPhi.push_back(Foam::constructSurfaceField(exec, nfMesh, phi));
+            nfPhi.back().internalField() = nfPhi.back().internalField() * scales[memberi];
+            ensembleT.setMember(memberi, nfT.back().internalField());
+        }
+
+        const Foam::scalar dt = runTime.deltaT().value();
+        Foam::scalar t = 0.0;
+        const Foam::label nSteps = 10;
+        for (Foam::label stepi = 0; stepi < nSteps; stepi++)
+        {
+            ensembleT.advanceUpwind(nfPhi[0].internalField(), fluxScale, dt);
+            for (NeoFOAM::label memberi = 0; memberi < nMembers; memberi++)
+            {
+                dsl::Expression eqnSys(
+                    dsl::imp::ddt(nfT[memberi]) + dsl::exp::div(nfPhi[memberi], nfT[memberi])
+                );
+                dsl::solve(eqnSys, nfT[memberi], t, dt, fvSchemesDict, fvSolutionDict);
+                nfT[memberi].correctBoundaryConditions();
+            }
+            t += dt;
+        }
+
+        NeoFOAM::Field<NeoFOAM::scalar> member(exec, nfMesh.nCells());
+        for (NeoFOAM::label memberi = 0; memberi < nMembers; memberi++)
+        {
+            ensembleT.getMember(memberi, member);
+            auto hostMember = member.copyToHost();
+            auto hostT = nfT[memberi].internalField().copyToHost();
+            auto memberSpan = hostMember.span();
+            auto span = hostT.span();
+            for (size_t celli = 0; celli < span.size(); celli++)
+            {
+                // the face contributions are summed in a different order
+                REQUIRE(memberSpan[celli] == Catch::Approx(span[celli]).margin(1e-12));
+            }
+        }
+    }
+}
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <sstream>
+
+#include "common.hpp"
+#include "FoamAdapter/setup/executorTuning.hpp"
+
+#include "IFstream.H"
+#include "OFstream.H"
+
+extern Foam::Time* timePtr; // A single time object
+
+namespace
+{
+
+// copy of the mesh from components, optionally with the point order of the first face rotated
+std::unique_ptr<Foam::polyMesh>
+copyMesh(const Foam::polyMesh& mesh, const Foam::word& name, const bool rotateFace)
+{
+    Foam::faceList faces(mesh.faces());
+    if (rotateFace)
+    {
+        const Foam::face f(faces[0]);
+        forAll(f, pointi)
+        {
+            faces[0][pointi] = f[f.fcIndex(pointi)];
+        }
+    }
+    auto copy = std::make_unique<Foam::polyMesh>(
+        Foam::IOobject(
+            name,
+            mesh.time().constant(),
+            mesh.time(),
+            Foam::IOobject::NO_READ,
+            Foam::IOobject::NO_WRITE,
+            false
+        ),
+        Foam::pointField(mesh.points()),
+        std::move(faces),
+        Foam::labelList(mesh.faceOwner()),
+        Foam::labelList(mesh.faceNeighbour())
+    );
+    const Foam::polyBoundaryMesh& bMesh = mesh.boundaryMesh();
+    Foam::PtrList<Foam::polyPatch> patches(bMesh.size());
+    forAll(bMesh, patchi)
+    {
+        patches.set(patchi, bMesh[patchi].clone(copy->boundaryMesh()));
+    }
+    copy->addPatches(patches);
+    return copy;
+}
+
+Foam::dictionary readCache(const Foam::fileName& file)
+{
+    Foam::IFstream is(file);
+    return Foam::dictionary(is);
+}
+
+void writeCache(const Foam::fileName& file, const Foam::dictionary& cache)
+{
+    Foam::OFstream os(file);
+    cache.writeEntries(os);
+}
+
+}
+
+TEST_CASE("computeMeshHash")
+{
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(runTime);
+    const Foam::fvMesh& mesh = *meshPtr;
+
+    SECTION("identical meshes")
+    {
+        auto copy = copyMesh(mesh, "copy", false);
+        REQUIRE(Foam::computeMeshHash(*copy) == Foam::computeMeshHash(mesh));
+    }
+
+    SECTION("face point order")
+    {
+        // same points, owner/neighbour and patches, only the faces differ
+        auto rotated = copyMesh(mesh, "rotated", true);
+        REQUIRE(Foam::computeMeshHash(*rotated) != Foam::computeMeshHash(mesh));
+    }
+}
+
+TEST_CASE("autoSelectExecutor")
+{
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(runTime);
+    const Foam::fvMesh& mesh = *meshPtr;
+
+    const Foam::fileName cacheFile = runTime.path() / "executorTuningTest" / "executorCache";
+    Foam::rmDir(cacheFile.path());
+
+    Foam::dictionary tuningDict;
+    tuningDict.add("repetitions", Foam::label(1));
+    tuningDict.add("cache", true);
+    tuningDict.add("cacheFile", cacheFile);
+
+    const Foam::word key = Foam::executorCacheKey(mesh);
+
+    SECTION("key")
+    {
+        REQUIRE(key == Foam::executorCacheKey(mesh));
+        REQUIRE(key.starts_with(Foam::hostName()));
+
+        std::ostringstream hash;
+        hash << std::hex << Foam::computeMeshHash(mesh);
+        REQUIRE(key.ends_with(hash.str()));
+
+        auto rotated = copyMesh(mesh, "rotated", true);
+        REQUIRE(Foam::executorCacheKey(*rotated) != key);
+    }
+
+    SECTION("stored and read back")
+    {
+        Foam::autoSelectExecutor(runTime, tuningDict);
+        REQUIRE(Foam::isFile(cacheFile));
+
+        Foam::dictionary cache = readCache(cacheFile);
+        REQUIRE(cache.isDict(key));
+        REQUIRE(cache.subDict(key).get<Foam::label>("nCells") == mesh.nCells());
+        const Foam::word selected = cache.subDict(key).get<Foam::word>("executor");
+        REQUIRE((selected == "Serial" || selected == "CPU" || selected == "GPU"));
+
+        // a cached decision is used without calibration
+        cache.subDict(key).set("executor", Foam::word("Serial"));
+        cache.subDict(key).set("div", -1.0);
+        writeCache(cacheFile, cache);
+        NeoFOAM::Executor exec = Foam::autoSelectExecutor(runTime, tuningDict);
+        REQUIRE(std::holds_alternative<NeoFOAM::SerialExecutor>(exec));
+        REQUIRE(readCache(cacheFile).subDict(key).get<Foam::scalar>("div") == -1.0);
+    }
+
+    SECTION("invalidated by another key")
+    {
+        // an entry of another machine or mesh is not used and kept
+        Foam::dictionary cache;
+        Foam::dictionary entry;
+        entry.add("executor", Foam::word("Serial"));
+        cache.add("otherHost_1_1_0", entry);
+        Foam::mkDir(cacheFile.path());
+        writeCache(cacheFile, cache);
+
+        Foam::autoSelectExecutor(runTime, tuningDict);
+
+        cache = readCache(cacheFile);
+        REQUIRE(cache.isDict("otherHost_1_1_0"));
+        REQUIRE(cache.isDict(key));
+        REQUIRE(cache.subDict(key).found("executor"));
+    }
+
+    SECTION("cache disabled")
+    {
+        tuningDict.set("cache", false);
+        Foam::autoSelectExecutor(runTime, tuningDict);
+        REQUIRE(!Foam::isFile(cacheFile));
+    }
+
+    Foam::rmDir(cacheFile.path());
+}
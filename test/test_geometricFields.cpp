@@ -4,9 +4,27 @@
 #define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
                             // a custom main
 
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "NeoFOAM/fields/field.hpp"
 
 #include "common.hpp"
+#include "FoamAdapter/comparison/errorNorms.hpp"
+#include "FoamAdapter/validation/shadowValidator.hpp"
+#include "FoamAdapter/readers/fieldFile.hpp"
+#include "FoamAdapter/monitoring/fieldStats.hpp"
+#include "FoamAdapter/monitoring/sampling.hpp"
+#include "FoamAdapter/insitu/extracts.hpp"
+#include "FoamAdapter/writers/timeSeries.hpp"
+#include "FoamAdapter/interpolation/cellToPoint.hpp"
+#include "FoamAdapter/writers.hpp"
+
+#include "volPointInterpolation.H"
 
 extern Foam::Time* timePtr; // A single time object
 
@@ -39,3 +57,687 @@ TEST_CASE("VolumeField")
         compare(nfU, ofU, ApproxVector(1e-15));
     }
 }
+
+TEST_CASE("fromFoamField")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    // the parallel first touch fill equals the copy from the host pointer
+    auto requireCopy = [&exec](const auto& foamField)
+    {
+        using mapped_t = typename Foam::type_map<std::decay_t<decltype(foamField)>>::mapped_type;
+        auto nfField = Foam::fromFoamField(exec, foamField);
+        NeoFOAM::Field<mapped_t> reference(
+            exec, reinterpret_cast<const mapped_t*>(foamField.cdata()), foamField.size()
+        );
+        REQUIRE(nfField.size() == reference.size());
+        auto hostField = nfField.copyToHost();
+        auto hostReference = reference.copyToHost();
+        auto span = hostField.span();
+        auto referenceSpan = hostReference.span();
+        for (size_t i = 0; i < span.size(); i++)
+        {
+            REQUIRE(span[i] == referenceSpan[i]);
+        }
+    };
+
+    // larger than a page and not a multiple of the chunk sizes
+    const Foam::label size = 100003;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> dis(-1.0, 1.0);
+
+    SECTION("scalarField " + execName)
+    {
+        Foam::scalarField field(size);
+        for (Foam::scalar& value : field)
+        {
+            value = dis(gen);
+        }
+        requireCopy(field);
+        requireCopy(Foam::scalarField());
+    }
+
+    SECTION("vectorField " + execName)
+    {
+        Foam::vectorField field(size);
+        for (Foam::vector& value : field)
+        {
+            value = Foam::vector(dis(gen), dis(gen), dis(gen));
+        }
+        requireCopy(field);
+    }
+
+    SECTION("labelList " + execName)
+    {
+        requireCopy(Foam::labelList(Foam::identity(size)));
+    }
+}
+
+TEST_CASE("FieldComparator")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh);
+    auto ofU = randomVectorField(runTime, mesh);
+
+    SECTION("identical fields " + execName)
+    {
+        auto nfT = constructFrom(exec, nfMesh, ofT);
+        Foam::ComparisonReport report = Foam::compareFields(nfT, ofT);
+        REQUIRE(report.internal.size == ofT.size());
+        REQUIRE(report.internal.linf == 0.0);
+        REQUIRE(report.within(1e-15));
+
+        auto nfU = constructFrom(exec, nfMesh, ofU);
+        REQUIRE(Foam::compareFields(nfU, ofU).within(1e-15));
+    }
+
+    SECTION("perturbed reference " + execName)
+    {
+        auto nfT = constructFrom(exec, nfMesh, ofT);
+        Foam::FieldComparator<Foam::volScalarField> comparator(exec, ofT);
+
+        Foam::label perturbedCell = ofT.size() / 2;
+        ofT[perturbedCell] += 0.5;
+        comparator.update(ofT);
+
+        Foam::ComparisonReport report = comparator.compare(nfT);
+        REQUIRE(report.worstCell == perturbedCell);
+        REQUIRE(report.internal.linf == Catch::Approx(0.5));
+        REQUIRE(report.internal.l1 == Catch::Approx(0.5 / ofT.size()));
+        REQUIRE(report.internal.l2 == Catch::Approx(std::sqrt(0.25 / ofT.size())));
+        REQUIRE_FALSE(report.within(0.1));
+    }
+}
+
+TEST_CASE("ShadowValidator")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh);
+    auto nfT = constructFrom(exec, nfMesh, ofT);
+
+    Foam::dictionary dict(
+        Foam::IStringStream("shadowValidation { active true; interval 1; tolerance 1e-12; }")()
+    );
+    Foam::ShadowValidator<Foam::volScalarField> validator(exec, ofT, dict);
+
+    // the reference only sees plain copies of the values
+    Foam::scalar boundarySum = 0;
+    auto step = [&boundarySum](Foam::scalarField& T, const Foam::scalarField& TBoundary)
+    {
+        boundarySum = sum(TBoundary);
+        T *= 2.0;
+    };
+
+    // the same step applied to the OpenFOAM field
+    Foam::volScalarField advancedT("advancedT", ofT);
+    advancedT.primitiveFieldRef() *= 2.0;
+    advancedT.correctBoundaryConditions();
+
+    SECTION("matching step " + execName)
+    {
+        validator.launch(0, nfT, step);
+        auto nfAdvanced = constructFrom(exec, nfMesh, advancedT);
+        validator.record(nfAdvanced);
+        validator.finish();
+
+        REQUIRE(validator.lastReport().has_value());
+        REQUIRE(validator.lastReport()->within(1e-12));
+        REQUIRE(validator.nFailed() == 0);
+        REQUIRE(boundarySum == Catch::Approx(sum(Foam::detail::flatBoundaryField(ofT))));
+    }
+
+    SECTION("mismatching step " + execName)
+    {
+        validator.launch(0, nfT, step);
+        validator.record(nfT);
+        validator.finish();
+
+        REQUIRE(validator.lastReport().has_value());
+        REQUIRE_FALSE(validator.lastReport()->within(1e-12));
+        REQUIRE(validator.nFailed() == 1);
+    }
+}
+
+TEST_CASE("readVolField")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+
+    Foam::volScalarField ofT(
+        Foam::IOobject("T", runTime.timeName(), mesh, Foam::IOobject::MUST_READ), mesh
+    );
+
+    SECTION("ascii " + execName)
+    {
+        auto nfT = Foam::readVolField<Foam::volScalarField>(exec, mesh, "T");
+        compare(nfT, ofT, ApproxScalar(1e-15));
+    }
+
+    SECTION("binary " + execName)
+    {
+        const Foam::word instance = "fieldFileBinary";
+        Foam::volScalarField binaryT(
+            Foam::IOobject("T", instance, mesh, Foam::IOobject::NO_READ, Foam::IOobject::NO_WRITE),
+            ofT
+        );
+        binaryT.writeObject(Foam::IOstreamOption(Foam::IOstreamOption::BINARY), true);
+
+        Foam::FieldFile file(runTime.path() / instance / "T");
+        REQUIRE(file.binary());
+        auto nfT = file.internalField<NeoFOAM::scalar>(exec, mesh.nCells());
+        auto hostT = nfT.copyToHost();
+        auto span = hostT.span();
+        for (Foam::label celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(span[celli] == ofT[celli]);
+        }
+
+        Foam::rmDir(runTime.path() / instance);
+    }
+
+    SECTION("binary boundaryField " + execName)
+    {
+        // calculated patches write their values as binary nonuniform lists
+        Foam::wordList patchTypes(mesh.boundary().size(), "calculated");
+        forAll(mesh.boundary(), patchi)
+        {
+            if (mesh.boundary()[patchi].type() == "empty")
+            {
+                patchTypes[patchi] = "empty";
+            }
+        }
+        Foam::volScalarField binaryT(
+            Foam::IOobject(
+                "TBinary",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE,
+                false
+            ),
+            mesh,
+            Foam::dimensionedScalar(ofT.dimensions(), 0),
+            patchTypes
+        );
+        binaryT.primitiveFieldRef() = ofT.primitiveField();
+        forAll(binaryT.boundaryField(), patchi)
+        {
+            Foam::fvPatchScalarField& pT = binaryT.boundaryFieldRef()[patchi];
+            forAll(pT, i)
+            {
+                pT[i] = 100.0 + i;
+            }
+        }
+        binaryT.writeObject(Foam::IOstreamOption(Foam::IOstreamOption::BINARY), true);
+
+        Foam::FieldFile file(runTime.timePath() / "TBinary");
+        REQUIRE(file.binary());
+        Foam::dictionary bField = file.boundaryField(mesh.boundaryMesh());
+        forAll(mesh.boundary(), patchi)
+        {
+            if (patchTypes[patchi] != "calculated")
+            {
+                continue;
+            }
+            const Foam::fvPatchScalarField& pT = binaryT.boundaryField()[patchi];
+            Foam::scalarField value(
+                "value", bField.subDict(mesh.boundary()[patchi].name()), pT.size()
+            );
+            forAll(pT, i)
+            {
+                REQUIRE(value[i] == pT[i]);
+            }
+        }
+
+        auto nfT = Foam::readVolField<Foam::volScalarField>(exec, mesh, "TBinary");
+        compare(nfT, binaryT, ApproxScalar(1e-15), false);
+
+        Foam::rm(runTime.timePath() / "TBinary");
+    }
+}
+
+TEST_CASE("FieldStats")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh);
+    auto ofU = randomVectorField(runTime, mesh);
+
+    SECTION("scalar " + execName)
+    {
+        auto nfT = constructFrom(exec, nfMesh, ofT);
+        Foam::FieldStats stats = Foam::computeFieldStats(nfT, {.nBins = 4});
+
+        REQUIRE(stats.size == ofT.size());
+        REQUIRE(stats.min == Foam::min(ofT.primitiveField()));
+        REQUIRE(stats.max == Foam::max(ofT.primitiveField()));
+        REQUIRE(stats.sum == Catch::Approx(Foam::sum(ofT.primitiveField())));
+        REQUIRE(stats.mean == Catch::Approx(ofT.weightedAverage(mesh.V()).value()));
+        REQUIRE(Foam::sum(stats.histogram) == ofT.size());
+    }
+
+    SECTION("vector " + execName)
+    {
+        auto nfU = constructFrom(exec, nfMesh, ofU);
+        Foam::FieldStats stats = Foam::computeFieldStats(nfU, {.nBins = 2, .min = 0, .max = 1});
+
+        REQUIRE(stats.max == Catch::Approx(Foam::max(Foam::mag(ofU.primitiveField()))));
+        // all magnitudes are above sqrt(3) and counted in the last bin
+        REQUIRE(stats.histogram[0] == 0);
+        REQUIRE(stats.histogram[1] == ofU.size());
+    }
+
+    SECTION("histogram of far out values " + execName)
+    {
+        ofT.primitiveFieldRef() = 0.5;
+        ofT[0] = 1e300;
+        ofT[1] = -1e300;
+        ofT[2] = std::numeric_limits<Foam::scalar>::quiet_NaN();
+        auto nfT = constructFrom(exec, nfMesh, ofT);
+        Foam::FieldStats stats = Foam::computeFieldStats(nfT, {.nBins = 4, .min = 0, .max = 1});
+
+        REQUIRE(stats.histogram[0] == 2);
+        REQUIRE(stats.histogram[1] == 0);
+        REQUIRE(stats.histogram[2] == ofT.size() - 3);
+        REQUIRE(stats.histogram[3] == 1);
+    }
+}
+
+TEST_CASE("SampleSet")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh);
+    auto nfT = constructFrom(exec, nfMesh, ofT);
+
+    const Foam::labelList probeCells {0, mesh.nCells() / 2, mesh.nCells() - 1};
+    Foam::pointField probes(probeCells.size());
+    forAll(probeCells, i)
+    {
+        probes[i] = mesh.C()[probeCells[i]];
+    }
+
+    SECTION("probes at cell centres " + execName)
+    {
+        using Interpolation = Foam::SampleSet::Interpolation;
+        for (auto interpolation : {Interpolation::cell, Interpolation::inverseDistance})
+        {
+            Foam::SampleSet set("probes", mesh, probes, interpolation);
+            const auto values = set.sample(nfT);
+            REQUIRE(values.size() == probes.size());
+            forAll(probeCells, i)
+            {
+                REQUIRE(values[i] == Catch::Approx(ofT[probeCells[i]]));
+            }
+        }
+    }
+
+    SECTION("inverse distance weights are bounded " + execName)
+    {
+        const Foam::boundBox& bb = mesh.bounds();
+        Foam::pointField line(10);
+        forAll(line, i)
+        {
+            line[i] = bb.min() + (bb.max() - bb.min()) * (i + 0.5) / line.size();
+        }
+        Foam::SampleSet set("line", mesh, line, Foam::SampleSet::Interpolation::inverseDistance);
+        for (const auto value : set.sample(nfT))
+        {
+            REQUIRE(value >= Foam::min(ofT.primitiveField()));
+            REQUIRE(value <= Foam::max(ofT.primitiveField()));
+        }
+    }
+}
+
+TEST_CASE("Samplers")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh);
+    auto nfT = constructFrom(exec, nfMesh, ofT);
+
+    SECTION("rows written by the pool " + execName)
+    {
+        Foam::pointField probes(2);
+        probes[0] = mesh.C()[0];
+        probes[1] = mesh.C()[mesh.nCells() - 1];
+        Foam::dictionary setDict;
+        setDict.add("type", Foam::word("probes"));
+        setDict.add("points", probes);
+        setDict.add("fields", Foam::wordList(1, "T"));
+        Foam::dictionary samplingDict;
+        samplingDict.add("samplersTest", setDict);
+        Foam::dictionary dict;
+        dict.add("sampling", samplingDict);
+
+        const Foam::fileName dir = runTime.globalPath() / "postProcessing" / "samplersTest";
+        const Foam::fileName file = dir / runTime.timeName() / "T";
+        Foam::rmDir(dir);
+        {
+            Foam::WorkStealingPool pool(2);
+            Foam::Samplers samplers(mesh, dict, &pool);
+            // opened under the start time before the first write
+            REQUIRE(Foam::isFile(file));
+
+            samplers.write(nfT);
+            samplers.write(nfT);
+            pool.wait();
+        }
+
+        std::ifstream is(file);
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(is, line);)
+        {
+            lines.push_back(line);
+        }
+        // one line per probe, the column header and two rows
+        REQUIRE(lines.size() == 5);
+        REQUIRE(lines[0].starts_with("# Probe 0"));
+        REQUIRE(lines[2].starts_with("#"));
+        std::istringstream row(lines[3]);
+        double time, value0, value1;
+        row >> time >> value0 >> value1;
+        REQUIRE(time == Catch::Approx(runTime.value()));
+        REQUIRE(value0 == Catch::Approx(ofT[0]).epsilon(1e-5));
+        REQUIRE(value1 == Catch::Approx(ofT[mesh.nCells() - 1]).epsilon(1e-5));
+        REQUIRE(lines[4] == lines[3]);
+
+        Foam::rmDir(dir);
+    }
+}
+
+TEST_CASE("Extract")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh);
+    auto nfT = constructFrom(exec, nfMesh, ofT);
+
+    Foam::dictionary dict;
+    dict.add("fields", Foam::wordList {Foam::word(nfT.name)});
+
+    SECTION("decimate " + execName)
+    {
+        dict.add("type", Foam::word("decimate"));
+        dict.add("stride", Foam::label(2));
+        Foam::Extract extract("decimate", mesh, dict);
+        const Foam::ExtractData data = extract.compute({&nfT});
+
+        REQUIRE(data.points.size() == (mesh.nCells() + 1) / 2);
+        forAll(data.points, pointi)
+        {
+            REQUIRE(data.points[pointi] == mesh.C()[2 * pointi]);
+            REQUIRE(data.fields[0].second[pointi] == ofT[2 * pointi]);
+        }
+    }
+
+    SECTION("iso " + execName)
+    {
+        // the random values are in [1, 2]
+        dict.add("type", Foam::word("iso"));
+        dict.add("isoField", Foam::word(nfT.name));
+        dict.add("isoValue", 1.5);
+        Foam::Extract extract("iso", mesh, dict);
+        const Foam::ExtractData data = extract.compute({&nfT});
+
+        REQUIRE(data.points.size() > 0);
+        for (const Foam::scalar value : data.fields[0].second)
+        {
+            REQUIRE(value == Catch::Approx(1.5));
+        }
+    }
+
+    SECTION("iso value outside the field range " + execName)
+    {
+        dict.add("type", Foam::word("iso"));
+        dict.add("isoField", Foam::word(nfT.name));
+        dict.add("isoValue", 3.0);
+        Foam::Extract extract("isoEmpty", mesh, dict);
+        const Foam::ExtractData data = extract.compute({&nfT});
+
+        REQUIRE(data.points.size() == 0);
+        REQUIRE(data.fields[0].second.size() == 0);
+
+        const Foam::fileName file = runTime.path() / "isoEmpty.vtp";
+        Foam::writeVtp(file, data);
+        std::ifstream is(file);
+        REQUIRE(is.good());
+        std::string line;
+        while (std::getline(is, line) && line.find("<Piece") == std::string::npos)
+        {}
+        REQUIRE(line.find("NumberOfPoints=\"0\"") != std::string::npos);
+        Foam::rm(file);
+    }
+}
+
+TEST_CASE("TimeSeries")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    bool compress = GENERATE(false, true);
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh);
+    auto nfT = constructFrom(exec, nfMesh, ofT);
+    const Foam::fileName file = runTime.path() / "timeSeriesTest" / "T.nfts";
+    const uint64_t hash = Foam::computeMeshHash(mesh);
+
+    SECTION("round trip " + execName)
+    {
+        {
+            Foam::TimeSeriesWriter writer(file, "T", 1, mesh.nCells(), hash, compress);
+            writer.append(0.1, nfT.internalField());
+            writer.append(0.2, nfT.internalField());
+        }
+        {
+            // continuing the file drops the records from the first new time on
+            Foam::TimeSeriesWriter writer(file, "T", 1, mesh.nCells(), hash, compress);
+            writer.append(0.2, nfT.internalField());
+            writer.append(0.3, nfT.internalField());
+        }
+
+        Foam::TimeSeriesReader reader(file);
+        REQUIRE(reader.header().meshHash == hash);
+        REQUIRE(reader.nRecords() == 3);
+        REQUIRE(reader.time(2) == 0.3);
+        REQUIRE(reader.findRecord(0.21) == 1);
+
+        auto hostT = reader.read<NeoFOAM::scalar>(exec, 2).copyToHost();
+        auto span = hostT.span();
+        for (Foam::label celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(span[celli] == ofT[celli]);
+        }
+
+        Foam::rmDir(file.path());
+    }
+
+    SECTION("compressed records " + execName)
+    {
+        // the random values do not compress, a uniform field does
+        NeoFOAM::Field<NeoFOAM::scalar> uniform(exec, mesh.nCells());
+        NeoFOAM::fill(uniform, 1.5);
+        {
+            Foam::TimeSeriesWriter writer(file, "T", 1, mesh.nCells(), hash, true);
+            writer.append(0.1, uniform);
+            writer.append(0.2, nfT.internalField());
+        }
+
+        Foam::TimeSeriesReader reader(file);
+        REQUIRE(reader.nRecords() == 2);
+        REQUIRE(reader.compressed(0));
+        auto hostUniform = reader.read<NeoFOAM::scalar>(exec, 0).copyToHost();
+        for (const NeoFOAM::scalar value : hostUniform.span())
+        {
+            REQUIRE(value == 1.5);
+        }
+        auto hostT = reader.read<NeoFOAM::scalar>(exec, 1).copyToHost();
+        for (Foam::label celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(hostT.span()[celli] == ofT[celli]);
+        }
+
+        Foam::rmDir(file.path());
+    }
+
+    SECTION("interrupted flush " + execName)
+    {
+        {
+            Foam::TimeSeriesWriter writer(file, "T", 1, mesh.nCells(), hash, compress);
+            writer.append(0.1, nfT.internalField());
+            writer.append(0.2, nfT.internalField());
+        }
+        // as if the flush of a new record stopped before the footer was written
+        std::filesystem::resize_file(file, std::filesystem::file_size(file) - 10);
+
+        const bool throwing = Foam::FatalError.throwing(true);
+        REQUIRE_THROWS_AS(Foam::TimeSeriesReader(file), Foam::error);
+        Foam::FatalError.throwing(throwing);
+
+        {
+            // the records are recovered from their headers
+            Foam::TimeSeriesWriter writer(file, "T", 1, mesh.nCells(), hash, compress);
+            writer.append(0.3, nfT.internalField());
+        }
+        Foam::TimeSeriesReader reader(file);
+        REQUIRE(reader.nRecords() == 3);
+        REQUIRE(reader.time(0) == 0.1);
+        REQUIRE(reader.time(2) == 0.3);
+        auto hostT = reader.read<NeoFOAM::scalar>(exec, 1).copyToHost();
+        for (Foam::label celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(hostT.span()[celli] == ofT[celli]);
+        }
+
+        Foam::rmDir(file.path());
+    }
+}
+
+TEST_CASE("CellToPointInterpolation")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh);
+    auto nfT = constructFrom(exec, nfMesh, ofT);
+    Foam::pointScalarField ofPointT(Foam::volPointInterpolation::New(mesh).interpolate(ofT));
+
+    Foam::CellToPointInterpolation interpolation(mesh);
+    REQUIRE(interpolation.nPoints() == mesh.nPoints());
+
+    SECTION("matches volPointInterpolation " + execName)
+    {
+        auto nfPointT = interpolation.interpolate(nfT).copyToHost();
+        auto span = nfPointT.span();
+        forAll(ofPointT, pointi)
+        {
+            REQUIRE(span[pointi] == Catch::Approx(ofPointT[pointi]).epsilon(1e-12));
+        }
+    }
+
+    SECTION("point field conversion " + execName)
+    {
+        auto nfPointT = Foam::fromFoamField(exec, ofPointT);
+        REQUIRE(nfPointT.size() == size_t(mesh.nPoints()));
+
+        Foam::pointScalarField copy("copy", ofPointT);
+        copy.primitiveFieldRef() = 0;
+        Foam::copyToFoam(nfPointT, copy);
+        forAll(copy, pointi)
+        {
+            REQUIRE(copy[pointi] == ofPointT[pointi]);
+        }
+    }
+}
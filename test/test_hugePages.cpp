@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <random>
+#include <span>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "catch2/common.hpp"
+
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+
+#include "FoamAdapter/readers.hpp"
+#include "FoamAdapter/memory/hugePages.hpp"
+
+namespace
+{
+
+// indirect access pattern of a face loop on a badly ordered mesh
+Foam::labelList randomAddressing(const Foam::label size)
+{
+    Foam::labelList addr(size);
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<Foam::label> dist(0, size - 1);
+    for (auto& a : addr)
+    {
+        a = dist(gen);
+    }
+    return addr;
+}
+
+void gather(
+    const NeoFOAM::Executor& exec,
+    std::span<const Foam::label> addr,
+    std::span<const NeoFOAM::scalar> values,
+    std::span<NeoFOAM::scalar> result
+)
+{
+    NeoFOAM::parallelFor(
+        exec, {0, result.size()}, KOKKOS_LAMBDA(const size_t i) { result[i] = values[addr[i]]; }
+    );
+    Kokkos::fence();
+}
+
+}
+
+TEST_CASE("hugePages")
+{
+    NeoFOAM::Executor exec = GENERATE(NeoFOAM::SerialExecutor {}, NeoFOAM::CPUExecutor {});
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    SECTION("conversion with transparent huge pages " + execName)
+    {
+        Foam::setHugePagePolicy(Foam::HugePagePolicy::transparent, 0);
+        const size_t advisedBefore = Foam::hugePageReport().advisedBytes;
+
+        const Foam::label size = 4 * 1024 * 1024;
+        Foam::scalarField ofField(size);
+        forAll(ofField, i)
+        {
+            ofField[i] = i;
+        }
+        auto nfField = Foam::fromFoamField(exec, ofField);
+        Foam::setHugePagePolicy(Foam::HugePagePolicy::none, 0);
+
+        auto nfFieldHost = nfField.copyToHost();
+        auto values = nfFieldHost.span();
+        bool equal = true;
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            equal = equal && values[i] == ofField[i];
+        }
+        REQUIRE(equal);
+
+#if defined(__linux__)
+        Foam::HugePageReport report = Foam::hugePageReport();
+        Foam::Info << report << Foam::endl;
+        if (report.mode != "never" && !report.mode.empty())
+        {
+            REQUIRE(report.advisedBytes > advisedBefore);
+        }
+#endif
+    }
+}
+
+// run with: adapter_hugePages "[benchmark]"
+TEST_CASE("hugePages gather benchmark", "[.][benchmark]")
+{
+    NeoFOAM::Executor exec = GENERATE(NeoFOAM::SerialExecutor {}, NeoFOAM::CPUExecutor {});
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    const Foam::label size = 32 * 1024 * 1024;
+    const Foam::labelList ofAddr = randomAddressing(size);
+    const Foam::scalarField ofValues(size, 1.0);
+
+    for (const auto policy : {Foam::HugePagePolicy::none, Foam::HugePagePolicy::transparent})
+    {
+        Foam::setHugePagePolicy(policy, 0);
+        auto addr = Foam::fromFoamField(exec, ofAddr);
+        auto values = Foam::fromFoamField(exec, ofValues);
+        NeoFOAM::Field<NeoFOAM::scalar> result(exec, size);
+        Foam::setHugePagePolicy(Foam::HugePagePolicy::none, 0);
+
+        const std::string name = execName
+                               + (policy == Foam::HugePagePolicy::none ? " 4k pages"
+                                                                       : " huge pages");
+        BENCHMARK(name.c_str()) { gather(exec, addr.span(), values.span(), result.span()); };
+    }
+    Foam::Info << Foam::hugePageReport() << Foam::endl;
+}
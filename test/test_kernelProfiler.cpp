@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "common.hpp"
+#include "FoamAdapter/profiling/kernelProfiler.hpp"
+
+#include "OStringStream.H"
+
+extern Foam::Time* timePtr; // A single time object
+
+TEST_CASE("operatorCosts")
+{
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(runTime);
+    const Foam::fvMesh& mesh = *meshPtr;
+
+    // the test mesh has 5x5 cells and 20 wall faces, the empty faces are not computed
+    REQUIRE(mesh.nCells() == 25);
+    REQUIRE(mesh.nInternalFaces() == 40);
+    REQUIRE(Foam::computeNBoundaryFaces(mesh) == 20);
+
+    const double s = sizeof(NeoFOAM::scalar);
+    const double l = sizeof(NeoFOAM::label);
+    const auto costs = Foam::operatorCosts(mesh);
+
+    REQUIRE(costs.size() == 4);
+    REQUIRE(costs.at("interpolation").bytes == 40 * (2 * l + 4 * s) + 20 * 2 * s);
+    REQUIRE(costs.at("interpolation").flops == 40 * 4);
+    REQUIRE(costs.at("div").bytes == 40 * (2 * l + 8 * s) + 20 * (l + 4 * s) + 25 * 3 * s);
+    REQUIRE(costs.at("div").flops == 40 * 7 + 20 * 2 + 25);
+    REQUIRE(costs.at("grad").bytes == 40 * (2 * l + 18 * s) + 20 * (l + 10 * s) + 25 * 7 * s);
+    REQUIRE(costs.at("grad").flops == 40 * 13 + 20 * 6 + 25 * 3);
+    REQUIRE(costs.at("bcUpdate").bytes == 20 * (l + 2 * s));
+    REQUIRE(costs.at("bcUpdate").flops == 0);
+}
+
+TEST_CASE("KernelProfiler")
+{
+    const Foam::KernelCost cost {.bytes = 1e6, .flops = 1e5};
+    Foam::label nCalls = 0;
+    auto kernel = [&nCalls]() { nCalls++; };
+
+    SECTION("without hardware counters")
+    {
+        // as if perf_event_open is not permitted
+        Foam::KernelProfiler profiler(100e9, 1e12, false);
+        for (Foam::label event = 0; event < Foam::PerfCounters::nEvents; event++)
+        {
+            REQUIRE(!profiler.counters().available(Foam::PerfCounters::Event(event)));
+        }
+
+        profiler.measure("kernel", cost, kernel, 3);
+        REQUIRE(nCalls == 3);
+        const auto& stats = profiler.stats().at("kernel");
+        REQUIRE(stats.calls == 3);
+        REQUIRE(stats.time >= 0);
+        REQUIRE(stats.cost.bytes == cost.bytes);
+        for (const uint64_t counter : stats.counters)
+        {
+            REQUIRE(counter == 0);
+        }
+
+        Foam::OStringStream os;
+        profiler.write(os);
+        REQUIRE(os.str().find("Hardware counters unavailable") != std::string::npos);
+    }
+
+    SECTION("with the counters of the machine")
+    {
+        // the counters may be unavailable, e.g. in containers, which must not fail
+        Foam::KernelProfiler profiler;
+        profiler.measure("kernel", cost, kernel, 2);
+        REQUIRE(nCalls == 2);
+        const auto& stats = profiler.stats().at("kernel");
+        REQUIRE(stats.calls == 2);
+        for (Foam::label event = 0; event < Foam::PerfCounters::nEvents; event++)
+        {
+            if (!profiler.counters().available(Foam::PerfCounters::Event(event)))
+            {
+                REQUIRE(stats.counters[event] == 0);
+            }
+        }
+        Foam::OStringStream os;
+        profiler.write(os);
+    }
+}
+
+TEST_CASE("profileKernels")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(runTime);
+
+    SECTION("fallback without hardware counters " + execName)
+    {
+        Foam::dictionary dict(Foam::IStringStream(
+            "kernelProfiling { active true; repetitions 1; hardwareCounters false; }"
+        )());
+        Foam::profileKernels(exec, *meshPtr, dict);
+    }
+
+    SECTION("inactive " + execName)
+    {
+        Foam::profileKernels(exec, *meshPtr, Foam::dictionary());
+    }
+}
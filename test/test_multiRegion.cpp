@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "common.hpp"
+#include "FoamAdapter/readers.hpp"
+#include "FoamAdapter/setup/multiRegion.hpp"
+
+extern Foam::Time* timePtr; // A single time object
+
+namespace
+{
+
+// a linear function of the position, mapped exactly between coincident faces
+Foam::scalar linear(const Foam::vector& x) { return 1.0 + 2.0 * x.x() + 3.0 * x.y(); }
+
+// flat boundary values of linear at the face centres in the NeoFOAM patch order
+Foam::scalarField linearBoundaryField(const Foam::fvMesh& mesh)
+{
+    const std::vector<NeoFOAM::localIdx> offsets = Foam::computeOffset(mesh);
+    Foam::scalarField values(offsets.back());
+    forAll(mesh.boundary(), patchi)
+    {
+        const Foam::fvPatch& patch = mesh.boundary()[patchi];
+        for (Foam::label facei = 0; facei < patch.size(); facei++)
+        {
+            values[offsets[patchi] + facei] = linear(patch.Cf()[facei]);
+        }
+    }
+    return values;
+}
+
+}
+
+TEST_CASE("RegionInterface")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    Foam::RegionMeshes regions(exec, *timePtr);
+
+    SECTION("regions " + execName)
+    {
+        REQUIRE(regions.size() == 2);
+        REQUIRE(regions.regionType("left") == "fluid");
+        REQUIRE(regions.regionType("right") == "solid");
+        REQUIRE(regions.interfaces().size() == 2);
+        REQUIRE(regions.interfaces("left").size() == 1);
+        REQUIRE(regions.interfaces("right").size() == 1);
+    }
+
+    SECTION("nearestPatchFace map " + execName)
+    {
+        for (const Foam::RegionInterface& interface : regions.interfaces())
+        {
+            const Foam::MeshAdapter& mesh = regions.mesh(interface.region);
+            const Foam::MeshAdapter& nbrMesh = regions.mesh(interface.nbrRegion);
+            const Foam::fvPatch& patch = mesh.boundary()[interface.patchi];
+            const Foam::fvPatch& nbrPatch = nbrMesh.boundary()[interface.nbrPatchi];
+            const NeoFOAM::label nbrOffset = Foam::computeOffset(nbrMesh)[interface.nbrPatchi];
+
+            REQUIRE(interface.size() == patch.size());
+            REQUIRE(interface.offset == Foam::computeOffset(mesh)[interface.patchi]);
+
+            auto nbrFaces = interface.nbrBoundaryFaces.copyToHost();
+            auto nbrCells = interface.nbrFaceCells.copyToHost();
+            for (Foam::label facei = 0; facei < patch.size(); facei++)
+            {
+                // the split faces coincide
+                const Foam::label nbrFacei = nbrFaces.span()[facei] - nbrOffset;
+                REQUIRE(mag(nbrPatch.Cf()[nbrFacei] - patch.Cf()[facei]) < 1e-12);
+                REQUIRE(nbrCells.span()[facei] == nbrPatch.faceCells()[nbrFacei]);
+            }
+        }
+    }
+
+    SECTION("mapInterface " + execName)
+    {
+        for (const Foam::RegionInterface& interface : regions.interfaces())
+        {
+            const Foam::MeshAdapter& mesh = regions.mesh(interface.region);
+            const Foam::MeshAdapter& nbrMesh = regions.mesh(interface.nbrRegion);
+
+            auto nbrValues = Foam::fromFoamField(exec, linearBoundaryField(nbrMesh));
+            const std::vector<NeoFOAM::localIdx> offsets = Foam::computeOffset(mesh);
+            NeoFOAM::Field<NeoFOAM::scalar> values(exec, offsets.back());
+            NeoFOAM::fill(values, -1.0);
+
+            Foam::mapInterface<NeoFOAM::scalar>(exec, interface, nbrValues.span(), values.span());
+
+            auto hostValues = values.copyToHost();
+            auto span = hostValues.span();
+            const Foam::fvPatch& patch = mesh.boundary()[interface.patchi];
+            forAll(mesh.boundary(), patchi)
+            {
+                for (Foam::label facei = 0; facei < mesh.boundary()[patchi].size(); facei++)
+                {
+                    const Foam::scalar value = span[offsets[patchi] + facei];
+                    if (patchi == interface.patchi)
+                    {
+                        REQUIRE(value == Catch::Approx(linear(patch.Cf()[facei])));
+                    }
+                    else
+                    {
+                        REQUIRE(value == -1.0);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -9,10 +9,22 @@
 
 #define namespaceFoam // Suppress <using namespace Foam;>
 #include "gaussConvectionScheme.H"
+#include "leastSquaresGrad.H"
+#include "gradScheme.H"
+#include "surfaceInterpolationScheme.H"
+#include "gaussLaplacianScheme.H"
+#include "snGradScheme.H"
 #include "NeoFOAM/core/input.hpp"
 #include "NeoFOAM/dsl/explicit.hpp"
 
 #include "common.hpp"
+#include "FoamAdapter/operators/leastSquaresGrad.hpp"
+#include "FoamAdapter/operators/gradScheme.hpp"
+#include "FoamAdapter/operators/laplacian.hpp"
+#include "FoamAdapter/operators/convection.hpp"
+#include "FoamAdapter/matrix/lduSolver.hpp"
+#include "FoamAdapter/interpolation/limitedSchemes.hpp"
+#include "FoamAdapter/readers/foamDictionary.hpp"
 
 namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
 namespace dsl = NeoFOAM::dsl;
@@ -109,6 +121,88 @@ TEST_CASE("GradOperator")
 }
 
 
+TEST_CASE("LeastSquaresGrad")
+{
+    Foam::Time& runTime = *timePtr;
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    std::unique_ptr<Foam::MeshAdapter> meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    NeoFOAM::UnstructuredMesh& nfMesh = mesh.nfMesh();
+
+    SECTION("leastSquares on " + execName)
+    {
+        Foam::IStringStream is("leastSquares");
+
+        auto ofT = randomScalarField(runTime, mesh);
+        auto nfT = constructFrom(exec, nfMesh, ofT);
+        nfT.correctBoundaryConditions();
+
+        Foam::fv::leastSquaresGrad<Foam::scalar> foamGradScalar(mesh, is);
+        Foam::volVectorField ofGradT("ofGradT", foamGradScalar.calcGrad(ofT, "test"));
+
+        auto nfGradT = constructFrom(exec, nfMesh, ofGradT);
+        NeoFOAM::fill(nfGradT.internalField(), NeoFOAM::Vector(0.0, 0.0, 0.0));
+        Foam::LeastSquaresGrad(mesh).grad(nfT, nfGradT);
+        nfGradT.correctBoundaryConditions();
+
+        compare(nfGradT, ofGradT, ApproxVector(1e-12), false);
+    }
+}
+
+
+TEST_CASE("LimitedGrad")
+{
+    Foam::Time& runTime = *timePtr;
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    std::string scheme = GENERATE(
+        std::string("cellLimited Gauss linear 1"),
+        std::string("cellLimited leastSquares 0.5"),
+        std::string("faceLimited Gauss linear 1"),
+        std::string("faceLimited leastSquares 0.5")
+    );
+
+    std::unique_ptr<Foam::MeshAdapter> meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    NeoFOAM::UnstructuredMesh& nfMesh = mesh.nfMesh();
+
+    SECTION(scheme + " on " + execName)
+    {
+        Foam::dictionary dict(Foam::IStringStream("grad " + scheme + ";")());
+
+        auto ofT = randomScalarField(runTime, mesh);
+        auto nfT = constructFrom(exec, nfMesh, ofT);
+        nfT.correctBoundaryConditions();
+
+        auto nfGrad = Foam::GradScheme::New(mesh, Foam::convert(dict.lookup("grad")));
+        auto foamGrad = Foam::fv::gradScheme<Foam::scalar>::New(mesh, dict.lookup("grad"));
+        Foam::volVectorField ofGradT("ofGradT", foamGrad->calcGrad(ofT, "test"));
+
+        auto nfGradT = constructFrom(exec, nfMesh, ofGradT);
+        NeoFOAM::fill(nfGradT.internalField(), NeoFOAM::Vector(0.0, 0.0, 0.0));
+        nfGrad->grad(nfT, nfGradT);
+        nfGradT.correctBoundaryConditions();
+
+        compare(nfGradT, ofGradT, ApproxVector(1e-12), false);
+    }
+}
+
+
 TEST_CASE("DivOperator")
 {
     Foam::Time& runTime = *timePtr;
@@ -169,6 +263,25 @@ TEST_CASE("DivOperator")
             compare(nfDivT, ofDivT, ApproxScalar(1e-15), false);
         }
 
+        SECTION("gather")
+        {
+            auto nfDivT = constructFrom(exec, nfMesh, ofDivT);
+            NeoFOAM::fill(nfDivT.internalField(), 0.0);
+            NeoFOAM::fill(nfDivT.boundaryField().value(), 0.0);
+
+            auto nfTf = constructSurfaceField(exec, nfMesh, ofPhi);
+            NeoFOAM::Input scheme = NeoFOAM::TokenList({std::string("linear")});
+            fvcc::SurfaceInterpolation interp(
+                exec, nfMesh, fvcc::SurfaceInterpolationFactory::create(exec, nfMesh, scheme)
+            );
+            interp.interpolate(nfT, nfTf);
+            Foam::gatherDiv(mesh.cellConnectivity(), nfMesh, nfPhi, nfTf, nfDivT);
+            nfDivT.correctBoundaryConditions();
+
+            // the face contributions are summed in a different order than by the scatter
+            compare(nfDivT, ofDivT, ApproxScalar(1e-12), false);
+        }
+
         SECTION("compute div from dsl::exp")
         {
             NeoFOAM::TokenList scheme =
@@ -189,3 +302,438 @@ TEST_CASE("DivOperator")
         }
     }
 }
+
+TEST_CASE("LimitedInterpolation")
+{
+    Foam::Time& runTime = *timePtr;
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    std::string scheme = GENERATE(
+        std::string("limitedLinear 1"), std::string("vanLeer"), std::string("linearUpwind grad(T)")
+    );
+
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    SECTION(scheme + " on " + execName)
+    {
+        Foam::dictionary dict(
+            Foam::IStringStream("interpolate " + scheme + "; div Gauss " + scheme + ";")()
+        );
+        NeoFOAM::Dictionary nfDict = Foam::readFoamDictionary(dict);
+
+        auto ofT = randomScalarField(runTime, mesh);
+        auto nfT = constructFrom(exec, nfMesh, ofT);
+        nfT.correctBoundaryConditions();
+
+        Foam::surfaceScalarField ofPhi(
+            Foam::IOobject(
+                "phi",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE
+            ),
+            mesh,
+            Foam::dimensionedScalar("phi", Foam::dimless, 0.0)
+        );
+        // both flow directions
+        forAll(ofPhi, facei)
+        {
+            ofPhi[facei] = facei % 2 == 0 ? facei : -facei;
+        }
+        auto nfPhi = constructSurfaceField(exec, nfMesh, ofPhi);
+
+        SECTION("interpolate")
+        {
+            Foam::surfaceScalarField ofSurfT(
+                Foam::surfaceInterpolationScheme<Foam::scalar>::New(
+                    mesh, ofPhi, dict.lookup("interpolate")
+                )
+                    ->interpolate(ofT)
+            );
+            auto nfSurfT = constructSurfaceField(exec, nfMesh, ofSurfT);
+            NeoFOAM::fill(nfSurfT.internalField(), 0.0);
+
+            NeoFOAM::Input tokens = nfDict.get<NeoFOAM::TokenList>("interpolate");
+            fvcc::SurfaceInterpolation interp(
+                exec, nfMesh, fvcc::SurfaceInterpolationFactory::create(exec, nfMesh, tokens)
+            );
+            interp.interpolate(nfPhi, nfT, nfSurfT);
+
+            compare(nfSurfT, ofSurfT, ApproxScalar(1e-12), false);
+        }
+
+        SECTION("div from divSchemes")
+        {
+            Foam::fv::gaussConvectionScheme<Foam::scalar> foamDivScalar(
+                mesh, ofPhi, Foam::IStringStream(scheme)()
+            );
+            Foam::volScalarField ofDivT("ofDivT", foamDivScalar.fvcDiv(ofPhi, ofT));
+
+            auto nfDivT = constructFrom(exec, nfMesh, ofDivT);
+            NeoFOAM::fill(nfDivT.internalField(), 0.0);
+            NeoFOAM::fill(nfDivT.boundaryField().value(), 0.0);
+            dsl::Operator divOp = dsl::exp::div(nfPhi, nfT);
+            divOp.build(nfDict.get<NeoFOAM::TokenList>("div"));
+            divOp.explicitOperation(nfDivT.internalField());
+            nfDivT.correctBoundaryConditions();
+
+            compare(nfDivT, ofDivT, ApproxScalar(1e-12), false);
+        }
+    }
+}
+
+TEST_CASE("Laplacian")
+{
+    Foam::Time& runTime = *timePtr;
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    std::string snGradScheme = GENERATE(std::string("corrected"), std::string("uncorrected"));
+    std::string patchType = GENERATE(std::string("zeroGradient"), std::string("fixedValue"));
+
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    SECTION(snGradScheme + " " + patchType + " on " + execName)
+    {
+        Foam::wordList patchTypes(mesh.boundary().size(), patchType);
+        forAll(mesh.boundary(), patchi)
+        {
+            if (mesh.boundary()[patchi].type() == "empty")
+            {
+                patchTypes[patchi] = "empty";
+            }
+        }
+        auto ofRandomT = randomScalarField(runTime, mesh);
+        Foam::volScalarField ofT(
+            Foam::IOobject(
+                "T",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE,
+                false
+            ),
+            mesh,
+            Foam::dimensionedScalar("T", Foam::dimless, 0.0),
+            patchTypes
+        );
+        ofT.primitiveFieldRef() = ofRandomT.primitiveField();
+        ofT.correctBoundaryConditions();
+        auto nfT = constructFrom(exec, nfMesh, ofT);
+        nfT.correctBoundaryConditions();
+
+        Foam::surfaceScalarField ofGamma(
+            Foam::IOobject(
+                "gamma",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE
+            ),
+            mesh,
+            Foam::dimensionedScalar("gamma", Foam::dimless, 1.5)
+        );
+        forAll(ofGamma, facei)
+        {
+            ofGamma[facei] = 1.0 + 0.01 * facei;
+        }
+        auto nfGamma = constructSurfaceField(exec, nfMesh, ofGamma);
+
+        NeoFOAM::TokenList scheme(
+            {std::string("Gauss"), std::string("linear"), std::string(snGradScheme)}
+        );
+        Foam::fv::gaussLaplacianScheme<Foam::scalar, Foam::scalar> foamLaplacian(
+            mesh, Foam::IStringStream("linear " + snGradScheme)()
+        );
+
+        SECTION("snGrad")
+        {
+            Foam::surfaceScalarField ofSnGradT(
+                Foam::fv::snGradScheme<Foam::scalar>::New(
+                    mesh, Foam::IStringStream(snGradScheme)()
+                )
+                    ->snGrad(ofT)
+            );
+            auto nfSnGradT = constructSurfaceField(exec, nfMesh, ofSnGradT);
+            NeoFOAM::fill(nfSnGradT.internalField(), 0.0);
+
+            Foam::SnGrad(mesh, NeoFOAM::TokenList({snGradScheme})).snGrad(nfT, nfSnGradT);
+
+            compare(nfSnGradT, ofSnGradT, ApproxScalar(1e-12), false);
+        }
+
+        SECTION("explicit")
+        {
+            Foam::volScalarField ofLapT("ofLapT", foamLaplacian.fvcLaplacian(ofGamma, ofT));
+            auto nfLapT = constructFrom(exec, nfMesh, ofLapT);
+            NeoFOAM::fill(nfLapT.internalField(), 0.0);
+
+            Foam::Laplacian(mesh, scheme).laplacian(nfGamma, nfT, nfLapT);
+
+            compare(nfLapT, ofLapT, ApproxScalar(1e-12), false);
+        }
+
+        SECTION("implicit")
+        {
+            Foam::tmp<Foam::fvScalarMatrix> tOfM = foamLaplacian.fvmLaplacian(ofGamma, ofT);
+            const Foam::fvScalarMatrix& ofM = tOfM();
+
+            // the boundary coefficients are part of the diagonal and source of the LduSystem
+            Foam::scalarField ofDiag(ofM.diag());
+            Foam::scalarField ofSource(ofM.source());
+            forAll(mesh.boundary(), patchi)
+            {
+                const Foam::labelUList& faceCells = mesh.boundary()[patchi].faceCells();
+                forAll(faceCells, i)
+                {
+                    ofDiag[faceCells[i]] += ofM.internalCoeffs()[patchi][i];
+                    ofSource[faceCells[i]] += ofM.boundaryCoeffs()[patchi][i];
+                }
+            }
+
+            Foam::LduSystem system(nfMesh);
+            Foam::Laplacian(mesh, scheme).assemble(nfGamma, nfT, system);
+
+            auto requireField =
+                [](const NeoFOAM::Field<NeoFOAM::scalar>& nfField, const Foam::scalarField& ofField)
+            {
+                auto nfHost = nfField.copyToHost();
+                REQUIRE_THAT(
+                    nfHost.span(),
+                    Catch::Matchers::RangeEquals(
+                        std::span(ofField.cdata(), ofField.size()), ApproxScalar(1e-12)
+                    )
+                );
+            };
+            requireField(system.diag, ofDiag);
+            requireField(system.upper, ofM.upper());
+            requireField(system.lower, ofM.lower());
+            requireField(system.source, ofSource);
+        }
+    }
+}
+
+TEST_CASE("Convection")
+{
+    Foam::Time& runTime = *timePtr;
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    std::string interpolation = GENERATE(std::string("upwind"), std::string("linear"));
+    std::string patchType = GENERATE(std::string("zeroGradient"), std::string("fixedValue"));
+
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    SECTION(interpolation + " " + patchType + " on " + execName)
+    {
+        Foam::wordList patchTypes(mesh.boundary().size(), patchType);
+        forAll(mesh.boundary(), patchi)
+        {
+            if (mesh.boundary()[patchi].type() == "empty")
+            {
+                patchTypes[patchi] = "empty";
+            }
+        }
+        auto ofRandomT = randomScalarField(runTime, mesh);
+        Foam::volScalarField ofT(
+            Foam::IOobject(
+                "T",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE,
+                false
+            ),
+            mesh,
+            Foam::dimensionedScalar("T", Foam::dimless, 0.0),
+            patchTypes
+        );
+        ofT.primitiveFieldRef() = ofRandomT.primitiveField();
+        // a nonzero uniform value read from the value entry of the fixedValue patches
+        forAll(ofT.boundaryField(), patchi)
+        {
+            if (patchType == "fixedValue" && patchTypes[patchi] == "fixedValue")
+            {
+                ofT.boundaryFieldRef()[patchi] == 2.0;
+            }
+        }
+        ofT.correctBoundaryConditions();
+        auto nfT = constructFrom(exec, nfMesh, ofT);
+        nfT.correctBoundaryConditions();
+
+        Foam::surfaceScalarField ofPhi(
+            Foam::IOobject(
+                "phi",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE
+            ),
+            mesh,
+            Foam::dimensionedScalar("phi", Foam::dimless, 0.0)
+        );
+        // both flow directions on the internal and the boundary faces
+        forAll(ofPhi, facei)
+        {
+            ofPhi[facei] = facei % 2 == 0 ? facei : -facei;
+        }
+        forAll(ofPhi.boundaryField(), patchi)
+        {
+            Foam::fvsPatchScalarField& pPhi = ofPhi.boundaryFieldRef()[patchi];
+            forAll(pPhi, i)
+            {
+                pPhi[i] = i % 2 == 0 ? 0.5 : -0.5;
+            }
+        }
+        auto nfPhi = constructSurfaceField(exec, nfMesh, ofPhi);
+
+        Foam::fv::gaussConvectionScheme<Foam::scalar> foamConvection(
+            mesh, ofPhi, Foam::IStringStream(interpolation)()
+        );
+        Foam::tmp<Foam::fvScalarMatrix> tOfM = foamConvection.fvmDiv(ofPhi, ofT);
+        const Foam::fvScalarMatrix& ofM = tOfM();
+
+        // the boundary coefficients are part of the diagonal and source of the LduSystem
+        Foam::scalarField ofDiag(ofM.diag());
+        Foam::scalarField ofSource(ofM.source());
+        forAll(mesh.boundary(), patchi)
+        {
+            const Foam::labelUList& faceCells = mesh.boundary()[patchi].faceCells();
+            forAll(faceCells, i)
+            {
+                ofDiag[faceCells[i]] += ofM.internalCoeffs()[patchi][i];
+                ofSource[faceCells[i]] += ofM.boundaryCoeffs()[patchi][i];
+            }
+        }
+
+        Foam::LduSystem system(nfMesh);
+        Foam::Convection(
+            mesh, NeoFOAM::TokenList({std::string("Gauss"), std::string(interpolation)})
+        )
+            .assemble(nfPhi, nfT, system);
+
+        auto requireField =
+            [](const NeoFOAM::Field<NeoFOAM::scalar>& nfField, const Foam::scalarField& ofField)
+        {
+            auto nfHost = nfField.copyToHost();
+            REQUIRE_THAT(
+                nfHost.span(),
+                Catch::Matchers::RangeEquals(
+                    std::span(ofField.cdata(), ofField.size()), ApproxScalar(1e-12)
+                )
+            );
+        };
+        requireField(system.diag, ofDiag);
+        requireField(system.upper, ofM.upper());
+        requireField(system.lower, ofM.lower());
+        requireField(system.source, ofSource);
+    }
+}
+
+TEST_CASE("LduSolver")
+{
+    Foam::Time& runTime = *timePtr;
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    std::string solverDict = GENERATE(
+        std::string("solver PCG; preconditioner DIC; tolerance 1e-10; relTol 0;"),
+        std::string("solver smoothSolver; smoother Jacobi; tolerance 1e-10; relTol 0;")
+    );
+
+    auto meshPtr = Foam::createMesh(exec, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    SECTION(solverDict + " on " + execName)
+    {
+        // laplacian(T) == 0 with T = 2 on all walls has the solution T = 2
+        Foam::wordList patchTypes(mesh.boundary().size(), "fixedValue");
+        forAll(mesh.boundary(), patchi)
+        {
+            if (mesh.boundary()[patchi].type() == "empty")
+            {
+                patchTypes[patchi] = "empty";
+            }
+        }
+        Foam::volScalarField ofT(
+            Foam::IOobject(
+                "T",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE,
+                false
+            ),
+            mesh,
+            Foam::dimensionedScalar("T", Foam::dimless, 2.0),
+            patchTypes
+        );
+        auto nfT = constructFrom(exec, nfMesh, ofT);
+        nfT.correctBoundaryConditions();
+
+        Foam::surfaceScalarField ofGamma(
+            Foam::IOobject(
+                "gamma",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE
+            ),
+            mesh,
+            Foam::dimensionedScalar("gamma", Foam::dimless, 1.0)
+        );
+        auto nfGamma = constructSurfaceField(exec, nfMesh, ofGamma);
+
+        NeoFOAM::TokenList scheme(
+            {std::string("Gauss"), std::string("linear"), std::string("corrected")}
+        );
+        Foam::LduSystem system(nfMesh);
+        Foam::Laplacian(mesh, scheme).assemble(nfGamma, nfT, system);
+
+        // a random initial guess
+        auto ofRandomT = randomScalarField(runTime, mesh);
+        NeoFOAM::Field<NeoFOAM::scalar> x = Foam::fromFoamField(exec, ofRandomT.primitiveField());
+
+        Foam::dictionary dict(Foam::IStringStream(solverDict)());
+        Foam::SolverPerformance performance =
+            Foam::LduSolver(mesh.cellConnectivity(), dict).solve(system, x, "T");
+
+        REQUIRE(performance.converged);
+        REQUIRE(performance.nIterations > 0);
+
+        auto xHost = x.copyToHost();
+        for (const NeoFOAM::scalar value : xHost.span())
+        {
+            REQUIRE(value == Catch::Approx(2.0).margin(1e-8));
+        }
+    }
+}
@@ -11,6 +11,7 @@
 #include "NeoFOAM/fields/field.hpp"
 #include "NeoFOAM/core/tokenList.hpp"
 
+#include "FoamAdapter/readers.hpp"
 #include "FoamAdapter/readers/foamDictionary.hpp"
 #include "FoamAdapter/writers.hpp"
 
@@ -78,3 +79,78 @@ TEST_CASE("read fvSchemes")
     REQUIRE(gradU.get<std::string>(0) == "Gauss");
     REQUIRE(gradU.get<std::string>(1) == "linear");
 }
+
+
+TEST_CASE("read boundary conditions")
+{
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = Foam::createMesh(NeoFOAM::SerialExecutor {}, runTime);
+    Foam::MeshAdapter& mesh = *meshPtr;
+    const NeoFOAM::UnstructuredMesh& nfMesh = mesh.nfMesh();
+
+    // a boundaryField dictionary with the given entries on all patches that are not empty
+    auto boundaryField = [&](const std::string& entries)
+    {
+        Foam::dictionary bDict;
+        forAll(mesh.boundary(), patchi)
+        {
+            const Foam::fvPatch& patch = mesh.boundary()[patchi];
+            const std::string patchEntries = patch.type() == "empty" ? "type empty;" : entries;
+            bDict.add(patch.name(), Foam::dictionary(Foam::IStringStream(patchEntries)()));
+        }
+        return bDict;
+    };
+
+    SECTION("uniform fixedValue")
+    {
+        auto bcs = Foam::volBoundaryConditions<NeoFOAM::Vector>(
+            nfMesh, boundaryField("type fixedValue; value uniform (1 2 3);")
+        );
+        fvcc::VolumeField<NeoFOAM::Vector> U(mesh.exec(), "U", nfMesh, bcs);
+        NeoFOAM::fill(U.internalField(), NeoFOAM::Vector(0.0, 0.0, 0.0));
+        U.correctBoundaryConditions();
+
+        auto values = U.boundaryField().value().copyToHost();
+        REQUIRE(values.size() > 0);
+        for (const NeoFOAM::Vector& value : values.span())
+        {
+            REQUIRE(value == NeoFOAM::Vector(1.0, 2.0, 3.0));
+        }
+    }
+
+    SECTION("uniform fixedGradient")
+    {
+        auto bcs = Foam::volBoundaryConditions<NeoFOAM::scalar>(
+            nfMesh, boundaryField("type fixedGradient; gradient uniform 2;")
+        );
+        fvcc::VolumeField<NeoFOAM::scalar> T(mesh.exec(), "T", nfMesh, bcs);
+        NeoFOAM::fill(T.internalField(), 1.0);
+        T.correctBoundaryConditions();
+
+        auto refGrad = T.boundaryField().refGrad().copyToHost();
+        REQUIRE(refGrad.size() > 0);
+        for (const NeoFOAM::scalar grad : refGrad.span())
+        {
+            REQUIRE(grad == 2.0);
+        }
+    }
+
+    SECTION("empty non-uniform list of a zero sized patch")
+    {
+        const Foam::dictionary patchDict(
+            Foam::IStringStream("type fixedValue; value nonuniform List<scalar> 0();")()
+        );
+        REQUIRE(Foam::readUniformEntry<NeoFOAM::scalar>(patchDict, "value") == 0.0);
+    }
+
+    SECTION("non-uniform fixedValue is rejected")
+    {
+        const Foam::dictionary bDict =
+            boundaryField("type fixedValue; value nonuniform List<scalar> 2(1 2);");
+        const bool throwing = Foam::FatalIOError.throwing(true);
+        REQUIRE_THROWS_AS(
+            Foam::volBoundaryConditions<NeoFOAM::scalar>(nfMesh, bDict), Foam::error
+        );
+        Foam::FatalIOError.throwing(throwing);
+    }
+}
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/common.hpp"
+
+#include "FoamAdapter/parallel/stepPipeline.hpp"
+#include "FoamAdapter/parallel/workStealingPool.hpp"
+
+TEST_CASE("WorkStealingPool")
+{
+    Foam::WorkStealingPool pool(4);
+    REQUIRE(pool.nThreads() == 4);
+
+    SECTION("wait finishes all jobs including jobs submitted by jobs")
+    {
+        const int n = 1000;
+        std::atomic<int> nFinished = 0;
+        for (int i = 0; i < n; i++)
+        {
+            pool.submit(
+                [&]()
+                {
+                    pool.submit([&]() { nFinished++; });
+                    nFinished++;
+                }
+            );
+        }
+        pool.wait();
+        REQUIRE(nFinished == 2 * n);
+    }
+}
+
+TEST_CASE("StepPipeline")
+{
+    Foam::StepPipeline pipeline(4);
+    const std::thread::id mainThread = std::this_thread::get_id();
+
+    SECTION("foreground tasks run on the calling thread in dependency order")
+    {
+        std::vector<int> order;
+        bool onMainThread = true;
+        auto record = [&](const int i)
+        {
+            return [&, i]()
+            {
+                onMainThread = onMainThread && std::this_thread::get_id() == mainThread;
+                order.push_back(i);
+            };
+        };
+        auto a = pipeline.add("a", record(0));
+        auto b = pipeline.add("b", record(1), {a});
+        pipeline.add("c", record(2), {a, b});
+        pipeline.run();
+
+        // run returns after the foreground tasks
+        REQUIRE(order == std::vector<int> {0, 1, 2});
+        REQUIRE(onMainThread);
+        pipeline.finish();
+    }
+
+    SECTION("background tasks of the same name run in step order after their dependencies")
+    {
+        const int nSteps = 50;
+        std::mutex mutex;
+        std::vector<int> written;
+        std::atomic<int> nStaged = 0;
+        bool stagedBeforeWrite = true;
+
+        for (int step = 0; step < nSteps; step++)
+        {
+            auto stage = pipeline.add("stage", [&]() { nStaged++; });
+            pipeline.addBackground(
+                "write",
+                [&, step]()
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stagedBeforeWrite = stagedBeforeWrite && nStaged > step;
+                    written.push_back(step);
+                },
+                {stage}
+            );
+            pipeline.run();
+        }
+        pipeline.finish();
+
+        REQUIRE(written.size() == nSteps);
+        REQUIRE(std::is_sorted(written.begin(), written.end()));
+        REQUIRE(stagedBeforeWrite);
+    }
+
+    SECTION("an exception of a background task is rethrown by finish")
+    {
+        pipeline.addBackground("fail", []() { throw std::runtime_error("background failure"); });
+        pipeline.run();
+        REQUIRE_THROWS_AS(pipeline.finish(), std::runtime_error);
+    }
+}
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <algorithm>
+#include <atomic>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/common.hpp"
+
+#include "FoamAdapter/parallel/taskGraph.hpp"
+
+TEST_CASE("TaskGraph")
+{
+    Foam::TaskGraph graph;
+
+    const size_t n = 1000;
+    std::vector<double> a(n, 0.0);
+    std::vector<double> b(n, 0.0);
+    std::vector<double> c(n, 0.0);
+    std::atomic<int> nFinished = 0;
+    int finishedBeforeJoin = -1;
+
+    auto fill = [&](std::vector<double>& values, const double value)
+    {
+        return [&values, value, &nFinished](const Foam::TaskContext& context)
+        {
+            double* data = values.data();
+            Foam::parallelFor(
+                context, {0, values.size()}, [=](const size_t i) { data[i] = value; }
+            );
+            nFinished++;
+        };
+    };
+
+    auto taskA = graph.add("a", fill(a, 1.0));
+    auto taskB = graph.add("b", fill(b, 2.0));
+    graph.add(
+        "c",
+        [&](const Foam::TaskContext& context)
+        {
+            finishedBeforeJoin = nFinished;
+            double* data = c.data();
+            const double* dataA = a.data();
+            const double* dataB = b.data();
+            Foam::parallelFor(
+                context, {0, n}, [=](const size_t i) { data[i] = dataA[i] + dataB[i]; }
+            );
+        },
+        {taskA, taskB}
+    );
+
+    auto waves = graph.waves();
+    REQUIRE(waves.size() == 2);
+    REQUIRE(waves[0].size() == 2);
+    REQUIRE(waves[1].size() == 1);
+
+    graph.run();
+
+    REQUIRE(finishedBeforeJoin == 2);
+    REQUIRE(std::all_of(c.begin(), c.end(), [](const double value) { return value == 3.0; }));
+}
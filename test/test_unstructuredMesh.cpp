@@ -12,6 +12,9 @@
 #include "FoamAdapter/setup.hpp"
 #include "FoamAdapter/comparison.hpp"
 #include "FoamAdapter/meshAdapter.hpp"
+#include "FoamAdapter/setup/meshConversion.hpp"
+#include "FoamAdapter/readers.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/operators/gaussGreenDiv.hpp"
 
 #define namespaceFoam // Suppress <using namespace Foam;>
 
@@ -234,6 +237,201 @@ TEST_CASE("unstructuredMesh")
 }
 
 
+template<typename ValueType>
+void requireEqual(const NeoFOAM::Field<ValueType>& a, const NeoFOAM::Field<ValueType>& b)
+{
+    REQUIRE(a.size() == b.size());
+    auto aHost = a.copyToHost();
+    auto bHost = b.copyToHost();
+    for (size_t i = 0; i < aHost.size(); i++)
+    {
+        REQUIRE(aHost.span()[i] == bHost.span()[i]);
+    }
+}
+
+TEST_CASE("chunked mesh conversion")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    std::unique_ptr<Foam::MeshAdapter> meshPtr = Foam::createMesh(exec, *timePtr);
+    const NeoFOAM::UnstructuredMesh& nfMesh = meshPtr->nfMesh();
+
+    SECTION("identical arrays " + execName)
+    {
+        // chunks smaller than most arrays of the test mesh
+        NeoFOAM::UnstructuredMesh chunked = Foam::readOpenFOAMMeshChunked(exec, *meshPtr, 1024);
+
+        requireEqual(chunked.points(), nfMesh.points());
+        requireEqual(chunked.cellVolumes(), nfMesh.cellVolumes());
+        requireEqual(chunked.cellCentres(), nfMesh.cellCentres());
+        requireEqual(chunked.faceAreas(), nfMesh.faceAreas());
+        requireEqual(chunked.faceCentres(), nfMesh.faceCentres());
+        requireEqual(chunked.magFaceAreas(), nfMesh.magFaceAreas());
+        requireEqual(chunked.faceOwner(), nfMesh.faceOwner());
+        requireEqual(chunked.faceNeighbour(), nfMesh.faceNeighbour());
+
+        const NeoFOAM::BoundaryMesh& bMesh = nfMesh.boundaryMesh();
+        const NeoFOAM::BoundaryMesh& chunkedBMesh = chunked.boundaryMesh();
+        REQUIRE(chunkedBMesh.offset() == bMesh.offset());
+        requireEqual(chunkedBMesh.faceCells(), bMesh.faceCells());
+        requireEqual(chunkedBMesh.cf(), bMesh.cf());
+        requireEqual(chunkedBMesh.cn(), bMesh.cn());
+        requireEqual(chunkedBMesh.sf(), bMesh.sf());
+        requireEqual(chunkedBMesh.magSf(), bMesh.magSf());
+        requireEqual(chunkedBMesh.nf(), bMesh.nf());
+        requireEqual(chunkedBMesh.delta(), bMesh.delta());
+        requireEqual(chunkedBMesh.weights(), bMesh.weights());
+        requireEqual(chunkedBMesh.deltaCoeffs(), bMesh.deltaCoeffs());
+    }
+}
+
+TEST_CASE("releaseFoamStorage")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    SECTION("cleared and recomputed " + execName)
+    {
+        Foam::setReleaseFoamStorage(true);
+        Foam::IOobject io(
+            Foam::polyMesh::defaultRegion,
+            timePtr->timeName(),
+            *timePtr,
+            Foam::IOobject::MUST_READ
+        );
+        Foam::MeshAdapter mesh(exec, io);
+        Foam::setReleaseFoamStorage(false);
+
+        REQUIRE(!mesh.hasCellCentres());
+        REQUIRE(!mesh.hasFaceAreas());
+        REQUIRE(!mesh.hasCellVolumes());
+
+        // OpenFOAM recomputes the released geometry on demand
+        const NeoFOAM::UnstructuredMesh& nfMesh = mesh.nfMesh();
+        REQUIRE(nfMesh.cellCentres() == mesh.cellCentres());
+        REQUIRE(nfMesh.cellVolumes() == mesh.cellVolumes());
+        REQUIRE(nfMesh.faceAreas() == mesh.faceAreas());
+        REQUIRE(nfMesh.faceOwner() == mesh.faceOwner());
+    }
+
+    SECTION("saved over a NeoFOAM step " + execName)
+    {
+        Foam::IOobject io(
+            Foam::polyMesh::defaultRegion,
+            timePtr->timeName(),
+            *timePtr,
+            Foam::IOobject::MUST_READ
+        );
+        size_t keptBytes = 0;
+        {
+            Foam::MeshAdapter mesh(exec, io);
+            keptBytes = mesh.foamGeometryBytes();
+        }
+        REQUIRE(keptBytes > 0);
+
+        Foam::setReleaseFoamStorage(true);
+        Foam::MeshAdapter mesh(exec, io);
+        Foam::setReleaseFoamStorage(false);
+        const NeoFOAM::UnstructuredMesh& nfMesh = mesh.nfMesh();
+
+        Foam::IOobject fieldIO(
+            "T", timePtr->timeName(), mesh, Foam::IOobject::NO_READ, Foam::IOobject::NO_WRITE, false
+        );
+        Foam::volScalarField T(fieldIO, mesh, Foam::dimensionedScalar(Foam::dimless, 1.0));
+        fieldIO.rename("phi");
+        Foam::surfaceScalarField phi(fieldIO, mesh, Foam::dimensionedScalar(Foam::dimless, 1.0));
+        auto nfT = Foam::constructFrom(exec, nfMesh, T);
+        auto nfDivT = Foam::constructFrom(exec, nfMesh, T);
+        auto nfPhi = Foam::constructSurfaceField(exec, nfMesh, phi);
+
+        // an explicit divergence step on the NeoFOAM mesh only
+        const size_t releasedBytes = mesh.foamGeometryBytes();
+        fvcc::GaussGreenDiv div(exec, nfMesh, NeoFOAM::TokenList({std::string("linear")}));
+        NeoFOAM::fill(nfDivT.internalField(), 0.0);
+        div.div(nfDivT, nfPhi, nfT);
+
+        REQUIRE(releasedBytes < keptBytes);
+        REQUIRE(mesh.foamGeometryBytes() == releasedBytes);
+
+        // any use of the OpenFOAM geometry computes it again
+        mesh.cellCentres();
+        REQUIRE(mesh.foamGeometryBytes() > releasedBytes);
+    }
+}
+
+TEST_CASE("cellConnectivity")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    std::unique_ptr<Foam::MeshAdapter> meshPtr = Foam::createMesh(exec, *timePtr);
+    const Foam::fvMesh& ofMesh = *meshPtr;
+    const Foam::CellConnectivity& connectivity = meshPtr->cellConnectivity();
+
+    SECTION("matches cells " + execName)
+    {
+        auto offsets = connectivity.offsets.copyToHost();
+        auto faces = connectivity.faces.copyToHost();
+        auto cells = connectivity.cells.copyToHost();
+        auto signs = connectivity.signs.copyToHost();
+
+        REQUIRE(offsets.size() == size_t(ofMesh.nCells() + 1));
+
+        // expected faces numbered as in the surface fields, i.e. without the empty patches
+        const Foam::label nInternalFaces = ofMesh.nInternalFaces();
+        std::vector<std::vector<std::pair<Foam::label, Foam::label>>> expected(ofMesh.nCells());
+        for (Foam::label facei = 0; facei < nInternalFaces; facei++)
+        {
+            const Foam::label own = ofMesh.faceOwner()[facei];
+            const Foam::label nei = ofMesh.faceNeighbour()[facei];
+            expected[own].push_back({facei, nei});
+            expected[nei].push_back({facei, own});
+        }
+        const auto offset = Foam::computeOffset(ofMesh);
+        forAll(ofMesh.boundary(), patchi)
+        {
+            const Foam::labelUList& faceCells = ofMesh.boundary()[patchi].faceCells();
+            forAll(faceCells, i)
+            {
+                expected[faceCells[i]].push_back({nInternalFaces + offset[patchi] + i, -1});
+            }
+        }
+
+        size_t nEntries = 0;
+        forAll(expected, celli)
+        {
+            const NeoFOAM::label start = offsets.span()[celli];
+            REQUIRE(size_t(offsets.span()[celli + 1] - start) == expected[celli].size());
+            for (size_t i = 0; i < expected[celli].size(); i++)
+            {
+                const auto [facei, other] = expected[celli][i];
+                const bool isOwner = facei >= nInternalFaces || ofMesh.faceOwner()[facei] == celli;
+                REQUIRE(faces.span()[start + i] == facei);
+                REQUIRE(cells.span()[start + i] == other);
+                REQUIRE(signs.span()[start + i] == (isOwner ? 1.0 : -1.0));
+            }
+            nEntries += expected[celli].size();
+        }
+        REQUIRE(faces.size() == nEntries);
+    }
+}
+
 TEST_CASE("fvccGeometryScheme")
 {
     NeoFOAM::Executor exec = GENERATE(
@@ -285,3 +483,72 @@ TEST_CASE("fvccGeometryScheme")
         );
     }
 }
+
+void requireNonOrthGeometry(const Foam::NonOrthGeometry& geometry, const Foam::fvMesh& mesh)
+{
+    const auto coeffsHost = geometry.deltaCoeffs.copyToHost();
+    const auto corrVecsHost = geometry.correctionVectors.copyToHost();
+    const Foam::surfaceScalarField& ofCoeffs = mesh.nonOrthDeltaCoeffs();
+    const Foam::surfaceVectorField& ofCorrVecs = mesh.nonOrthCorrectionVectors();
+
+    size_t facei = 0;
+    auto requireFace = [&](const Foam::scalar coeff, const Foam::vector& corrVec)
+    {
+        REQUIRE(ApproxScalar(1e-12)(coeffsHost.span()[facei], coeff));
+        REQUIRE(ApproxVector(1e-12)(corrVecsHost.span()[facei], corrVec));
+        facei++;
+    };
+    forAll(ofCoeffs, i)
+    {
+        requireFace(ofCoeffs[i], ofCorrVecs[i]);
+    }
+    forAll(ofCoeffs.boundaryField(), patchi)
+    {
+        forAll(ofCoeffs.boundaryField()[patchi], i)
+        {
+            requireFace(ofCoeffs.boundaryField()[patchi][i], ofCorrVecs.boundaryField()[patchi][i]);
+        }
+    }
+    REQUIRE(facei == coeffsHost.size());
+}
+
+TEST_CASE("nonOrthGeometry")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    std::unique_ptr<Foam::MeshAdapter> meshPtr = Foam::createMesh(exec, *timePtr);
+    Foam::MeshAdapter& mesh = *meshPtr;
+
+    SECTION("converted with the mesh " + execName)
+    {
+        requireNonOrthGeometry(mesh.nonOrthGeometry(), mesh);
+    }
+
+    SECTION("skewed mesh " + execName)
+    {
+        // shear the interior points, the faces between them are no longer orthogonal to the
+        // cell centre connections
+        const Foam::boundBox& bb = mesh.bounds();
+        const Foam::vector span = bb.span();
+        Foam::pointField points(mesh.points());
+        forAll(points, pointi)
+        {
+            const Foam::vector rel = Foam::cmptDivide(points[pointi] - bb.min(), span);
+            if (rel.x() > 1e-6 && rel.x() < 1 - 1e-6 && rel.y() > 1e-6 && rel.y() < 1 - 1e-6)
+            {
+                points[pointi].x() += 0.1 * span.x() * (rel.y() - 0.5);
+            }
+        }
+        mesh.movePoints(points);
+
+        requireNonOrthGeometry(
+            Foam::computeNonOrthGeometry(Foam::readOpenFOAMMesh(exec, mesh)), mesh
+        );
+    }
+}